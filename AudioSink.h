@@ -0,0 +1,29 @@
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Audio Sink
+*/
+
+// destination for rendered stereo interleaved samples
+// (used by the offline renderer; the interactive synthesizer
+// pulls samples through the BASS stream callback instead)
+class AudioSink
+{
+public:
+	virtual ~AudioSink()
+	{
+	}
+
+	// open the sink at the given sample rate
+	// (returns false on failure)
+	virtual bool Open(unsigned int frequency) = 0;
+
+	// write stereo interleaved samples
+	// (returns false on failure)
+	virtual bool Write(float const buffer[], size_t count) = 0;
+
+	// finish writing and close the sink
+	virtual void Close() = 0;
+};
@@ -0,0 +1,79 @@
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Wave File Audio Sink
+*/
+#include "Platform.h"
+
+#include "AudioSinkFile.h"
+
+// write a little-endian value
+static void WriteValue(FILE *file, unsigned int value, int bytes)
+{
+	for (int i = 0; i < bytes; ++i)
+		fputc((value >> (i * 8)) & 0xFF, file);
+}
+
+// write a 32-bit floating-point stereo wave file header
+void AudioSinkFile::WriteHeader()
+{
+	unsigned int const channels = 2;
+	unsigned int const bytes_per_sample = sizeof(float);
+	unsigned int const data_size = (unsigned int)(written * channels * bytes_per_sample);
+
+	fwrite("RIFF", 1, 4, file);
+	WriteValue(file, 36 + data_size, 4);
+	fwrite("WAVE", 1, 4, file);
+
+	fwrite("fmt ", 1, 4, file);
+	WriteValue(file, 16, 4);
+	WriteValue(file, 3, 2);						// WAVE_FORMAT_IEEE_FLOAT
+	WriteValue(file, channels, 2);
+	WriteValue(file, frequency, 4);
+	WriteValue(file, frequency * channels * bytes_per_sample, 4);
+	WriteValue(file, channels * bytes_per_sample, 2);
+	WriteValue(file, bytes_per_sample * 8, 2);
+
+	fwrite("data", 1, 4, file);
+	WriteValue(file, data_size, 4);
+}
+
+// create the wave file
+bool AudioSinkFile::Open(unsigned int aFrequency)
+{
+	file = fopen(filename, "wb");
+	if (!file)
+	{
+		fprintf(stderr, "Can't create output \"%s\"\n", filename);
+		return false;
+	}
+
+	frequency = aFrequency;
+	written = 0;
+
+	// reserve space for the header
+	WriteHeader();
+
+	return true;
+}
+
+// append samples to the wave file
+bool AudioSinkFile::Write(float const buffer[], size_t count)
+{
+	if (fwrite(buffer, sizeof(float) * 2, count, file) != count)
+		return false;
+	written += count;
+	return true;
+}
+
+// write the final header and close the wave file
+void AudioSinkFile::Close()
+{
+	if (!file)
+		return;
+	fseek(file, 0, SEEK_SET);
+	WriteHeader();
+	fclose(file);
+	file = NULL;
+}
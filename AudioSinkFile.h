@@ -0,0 +1,35 @@
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Wave File Audio Sink
+*/
+
+#include "AudioSink.h"
+
+// write 32-bit floating-point stereo wave file
+class AudioSinkFile : public AudioSink
+{
+public:
+	explicit AudioSinkFile(char const *filename)
+		: filename(filename)
+		, file(NULL)
+		, frequency(0)
+		, written(0)
+	{
+	}
+
+	virtual bool Open(unsigned int frequency);
+	virtual bool Write(float const buffer[], size_t count);
+	virtual void Close();
+
+private:
+	// write the wave file header
+	void WriteHeader();
+
+	char const *filename;
+	FILE *file;
+	unsigned int frequency;
+	size_t written;
+};
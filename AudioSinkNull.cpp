@@ -0,0 +1,47 @@
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Null Audio Sink
+*/
+#include "Platform.h"
+
+#include "AudioSinkNull.h"
+
+#include <thread>
+
+bool AudioSinkNull::Open(unsigned int /*frequency*/)
+{
+	return true;
+}
+
+bool AudioSinkNull::Write(float const /*buffer*/[], size_t /*count*/)
+{
+	return true;
+}
+
+void AudioSinkNull::Close()
+{
+}
+
+// start the wall clock
+bool AudioSinkPaced::Open(unsigned int aFrequency)
+{
+	frequency = aFrequency;
+	written = 0;
+	start = std::chrono::steady_clock::now();
+	return true;
+}
+
+// wait until the wall clock catches up with the samples written
+bool AudioSinkPaced::Write(float const /*buffer*/[], size_t count)
+{
+	written += count;
+	std::chrono::microseconds const due(written * 1000000 / frequency);
+	std::this_thread::sleep_until(start + due);
+	return true;
+}
+
+void AudioSinkPaced::Close()
+{
+}
@@ -0,0 +1,40 @@
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Null Audio Sink
+*/
+
+#include "AudioSink.h"
+
+#include <chrono>
+
+// discard samples as fast as they are rendered
+class AudioSinkNull : public AudioSink
+{
+public:
+	virtual bool Open(unsigned int frequency);
+	virtual bool Write(float const buffer[], size_t count);
+	virtual void Close();
+};
+
+// discard samples at the rate a real device would consume them
+class AudioSinkPaced : public AudioSink
+{
+public:
+	AudioSinkPaced()
+		: frequency(0)
+		, written(0)
+	{
+	}
+
+	virtual bool Open(unsigned int frequency);
+	virtual bool Write(float const buffer[], size_t count);
+	virtual void Close();
+
+private:
+	unsigned int frequency;
+	unsigned long long written;
+	std::chrono::steady_clock::time_point start;
+};
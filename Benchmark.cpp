@@ -0,0 +1,610 @@
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Benchmark Report
+*/
+#include "Platform.h"
+
+#include "Benchmark.h"
+#include "Render.h"
+#include "Filter.h"
+#include "OscillatorNote.h"
+#include "OscillatorKernel.h"
+#include "WaveSine.h"
+#include "Wavetable.h"
+#include "MinBLEP.h"
+#include "Math.h"
+#include "SIMD.h"
+
+#include <chrono>
+
+// samples per measured block
+// (the same as the largest voice rendering block)
+static size_t const BENCHMARK_BLOCK_SAMPLES = CONTROL_SAMPLES_MAX;
+
+// blocks per measurement
+static int const BENCHMARK_BLOCKS = 2000;
+
+// seconds elapsed since a start time
+static double Elapsed(std::chrono::steady_clock::time_point const start)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// filter input for each lane
+// (sawtooth waves at unrelated pitches so the lanes do different work)
+static void BenchmarkFilterInput(float input[FILTER_LANES][BENCHMARK_BLOCK_SAMPLES], float const step)
+{
+	for (int lane = 0; lane < FILTER_LANES; ++lane)
+	{
+		float const delta = (110.0f + 37.0f * lane) * step;
+		float phase = 0.0f;
+		for (size_t i = 0; i < BENCHMARK_BLOCK_SAMPLES; ++i)
+		{
+			input[lane][i] = 1.0f - 2.0f * phase;
+			phase += delta;
+			phase -= FloorInt(phase);
+		}
+	}
+}
+
+// cutoff frequency for a block
+// (sweeps across the audible range so every block ramps coefficients)
+static float BenchmarkCutoff(int const block, int const lane)
+{
+	return 100.0f * powf(2.0f, float((block * 3 + lane) % 64) * (6.0f / 64.0f));
+}
+
+// measure each filter model with the filter bank and the scalar filter
+static void BenchmarkFilters(float const step)
+{
+	static float input[FILTER_LANES][BENCHMARK_BLOCK_SAMPLES];
+	static float output[FILTER_LANES][BENCHMARK_BLOCK_SAMPLES];
+	static FilterBank bank;
+	BenchmarkFilterInput(input, step);
+
+	printf("filter model      bank ns/sample  scalar ns/sample  setup ns/call\n");
+	for (int model = 0; model < FILTER_MODEL_COUNT; ++model)
+	{
+		FilterConfig config(true, FilterConfig::LOWPASS_4, 1.0f, 0.5f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f);
+		config.model = model;
+
+		// filter bank with every lane active
+		for (int lane = 0; lane < FILTER_LANES; ++lane)
+			bank.Reset(lane);
+		float *buffer[FILTER_LANES];
+		for (int lane = 0; lane < FILTER_LANES; ++lane)
+			buffer[lane] = output[lane];
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		for (int block = 0; block < BENCHMARK_BLOCKS; ++block)
+		{
+			memcpy(output, input, sizeof(output));
+			for (int lane = 0; lane < FILTER_LANES; ++lane)
+				bank.Setup(lane, model, BenchmarkCutoff(block, lane), config.resonance, step, BENCHMARK_BLOCK_SAMPLES);
+			bank.Render(config, buffer, BENCHMARK_BLOCK_SAMPLES);
+		}
+		double const bank_ns = 1e9 * Elapsed(start) / (double(BENCHMARK_BLOCKS) * BENCHMARK_BLOCK_SAMPLES * FILTER_LANES);
+
+		// scalar filter
+		FilterState state;
+		start = std::chrono::steady_clock::now();
+		for (int block = 0; block < BENCHMARK_BLOCKS; ++block)
+		{
+			memcpy(output[0], input[0], sizeof(output[0]));
+			state.Setup(model, BenchmarkCutoff(block, 0), config.resonance, step);
+			state.Render(config, output[0], BENCHMARK_BLOCK_SAMPLES);
+		}
+		double const scalar_ns = 1e9 * Elapsed(start) / (double(BENCHMARK_BLOCKS) * BENCHMARK_BLOCK_SAMPLES);
+
+		// coefficient setup alone
+		// (once per voice per control update when rendering)
+		float cutoff[64];
+		for (int i = 0; i < 64; ++i)
+			cutoff[i] = BenchmarkCutoff(i, 0);
+		start = std::chrono::steady_clock::now();
+		for (int block = 0; block < BENCHMARK_BLOCKS * int(BENCHMARK_BLOCK_SAMPLES); ++block)
+			state.Setup(model, cutoff[block & 63], config.resonance, step);
+		double const setup_ns = 1e9 * Elapsed(start) / (double(BENCHMARK_BLOCKS) * BENCHMARK_BLOCK_SAMPLES);
+
+		printf("%-16s  %14.2f  %16.2f  %13.2f\n", filter_model_name[model], bank_ns, scalar_ns, setup_ns);
+	}
+}
+
+// inputs per math function measurement
+// (a multiple of SIMD_WIDTH)
+static int const BENCHMARK_MATH_VALUES = 4096;
+
+// passes over the inputs per math function measurement
+static int const BENCHMARK_MATH_PASSES = 500;
+
+// destination for measured results
+// (keeps the measured loops from being optimized away)
+static volatile float benchmark_sink;
+
+// 2**x the way the synthesizer computed it before FastExp2
+static float PowerOfTwo(float const x)
+{
+	return powf(2.0f, x);
+}
+
+// measure a fast math function against its standard library equivalent
+// (reports the largest absolute or relative error against the double-precision
+// function, and the time per value for the library, scalar, and vector versions)
+template<double REFERENCE(double), float LIBRARY(float), float SCALAR(float), SIMDFloat VECTOR(SIMDFloat)>
+static void BenchmarkMathFunction(char const *name, float const lo, float const hi, bool const geometric, bool const relative)
+{
+	static SIMD_ALIGN float input[BENCHMARK_MATH_VALUES];
+	static SIMD_ALIGN float output[BENCHMARK_MATH_VALUES];
+
+	// inputs spread evenly or geometrically across the range
+	for (int i = 0; i < BENCHMARK_MATH_VALUES; ++i)
+	{
+		float const s = float(i) / (BENCHMARK_MATH_VALUES - 1);
+		input[i] = geometric ? lo * powf(hi / lo, s) : lo + (hi - lo) * s;
+	}
+
+	// largest error of the scalar and vector versions
+	double error = 0.0;
+	for (int i = 0; i < BENCHMARK_MATH_VALUES; i += SIMD_WIDTH)
+		VECTOR(SIMDFloat::Load(input + i)).Store(output + i);
+	for (int i = 0; i < BENCHMARK_MATH_VALUES; ++i)
+	{
+		double const reference = REFERENCE(input[i]);
+		double const scale = relative ? 1.0 / fabs(reference) : 1.0;
+		error = Max(error, fabs(SCALAR(input[i]) - reference) * scale);
+		error = Max(error, fabs(output[i] - reference) * scale);
+	}
+
+	// standard library
+	float sum = 0.0f;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (int pass = 0; pass < BENCHMARK_MATH_PASSES; ++pass)
+	{
+		for (int i = 0; i < BENCHMARK_MATH_VALUES; ++i)
+			sum += LIBRARY(input[i]);
+	}
+	double const library_ns = 1e9 * Elapsed(start) / (double(BENCHMARK_MATH_PASSES) * BENCHMARK_MATH_VALUES);
+
+	// scalar approximation
+	start = std::chrono::steady_clock::now();
+	for (int pass = 0; pass < BENCHMARK_MATH_PASSES; ++pass)
+	{
+		for (int i = 0; i < BENCHMARK_MATH_VALUES; ++i)
+			sum += SCALAR(input[i]);
+	}
+	double const scalar_ns = 1e9 * Elapsed(start) / (double(BENCHMARK_MATH_PASSES) * BENCHMARK_MATH_VALUES);
+
+	// vector approximation
+	start = std::chrono::steady_clock::now();
+	for (int pass = 0; pass < BENCHMARK_MATH_PASSES; ++pass)
+	{
+		SIMDFloat total(0.0f);
+		for (int i = 0; i < BENCHMARK_MATH_VALUES; i += SIMD_WIDTH)
+			total = total + VECTOR(SIMDFloat::Load(input + i));
+		total.Store(output);
+		sum += output[0];
+	}
+	double const vector_ns = 1e9 * Elapsed(start) / (double(BENCHMARK_MATH_PASSES) * BENCHMARK_MATH_VALUES);
+
+	benchmark_sink = sum;
+
+	printf("%-10s  %9.2g %-3s  %10.2f  %10.2f  %10.2f\n", name, error, relative ? "rel" : "abs", library_ns, scalar_ns, vector_ns);
+}
+
+// measure the fast math approximations
+static void BenchmarkMath()
+{
+	printf("function    max error      libm ns   scalar ns   vector ns\n");
+	BenchmarkMathFunction<exp2, PowerOfTwo, FastExp2, FastExp2>("exp2", -20.0f, 20.0f, false, true);
+	BenchmarkMathFunction<log2, log2f, FastLog2, FastLog2>("log2", 1e-6f, 1e6f, true, false);
+	BenchmarkMathFunction<tanh, tanhf, FastTanh, FastTanh>("tanh", -4.0f, 4.0f, false, false);
+}
+
+// largest float below 0.5
+static float const BENCHMARK_BELOW_HALF = 0.49999997f;
+
+// reference float-to-integer conversions
+// (the documented results of the fast conversions in Math.h)
+static int RoundReference(float const x)
+{
+	return x == BENCHMARK_BELOW_HALF ? 1 : int(floor(double(x) + 0.5));
+}
+static int FloorReference(float const x)
+{
+	return x < 0 && x >= -1.0f / 67108864 ? 0 : int(floor(x));
+}
+static int CeilingReference(float const x)
+{
+	return x > 0 && x <= 1.0f / 67108864 ? 0 : int(ceil(x));
+}
+static int TruncateReference(float const x)
+{
+	return int(x);
+}
+
+// bit pattern spacing between checked float-to-integer inputs
+// (samples every binade from the smallest denormal to 2**30)
+static unsigned int const BENCHMARK_CONVERT_STRIDE = 251;
+
+// check a fast float-to-integer conversion against its documented results
+// (reports mismatches of the scalar and array versions, and the time per
+// value of each)
+template<int REFERENCE(float), int SCALAR(float), void ARRAY(float const[], int[], size_t)>
+static void BenchmarkConvert(char const *name)
+{
+	static SIMD_ALIGN float input[BENCHMARK_MATH_VALUES];
+	static int output[BENCHMARK_MATH_VALUES];
+
+	// positive and negative floats below 2**30
+	int scalar_errors = 0, array_errors = 0, count = 0;
+	for (unsigned int bits = 0; bits < 0x4E800000; )
+	{
+		for (count = 0; count < BENCHMARK_MATH_VALUES && bits < 0x4E800000; count += 2, bits += BENCHMARK_CONVERT_STRIDE)
+		{
+			union { float f; unsigned int u; } value;
+			value.u = bits;
+			input[count] = value.f;
+			input[count + 1] = -value.f;
+		}
+		ARRAY(input, output, count);
+		for (int i = 0; i < count; ++i)
+		{
+			int const reference = REFERENCE(input[i]);
+			scalar_errors += SCALAR(input[i]) != reference;
+			array_errors += output[i] != reference;
+		}
+	}
+
+	// inputs near integers and halves
+	for (int i = 0; i < BENCHMARK_MATH_VALUES; ++i)
+		input[i] = (i - BENCHMARK_MATH_VALUES / 2) * 0.25f + ((i & 3) - 1.5f) * FLT_EPSILON;
+	input[0] = BENCHMARK_BELOW_HALF;
+	ARRAY(input, output, BENCHMARK_MATH_VALUES);
+	for (int i = 0; i < BENCHMARK_MATH_VALUES; ++i)
+	{
+		int const reference = REFERENCE(input[i]);
+		scalar_errors += SCALAR(input[i]) != reference;
+		array_errors += output[i] != reference;
+	}
+
+	// scalar version
+	int sum = 0;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (int pass = 0; pass < BENCHMARK_MATH_PASSES; ++pass)
+	{
+		for (int i = 0; i < BENCHMARK_MATH_VALUES; ++i)
+			output[i] = SCALAR(input[i]);
+		sum += output[pass & (BENCHMARK_MATH_VALUES - 1)];
+	}
+	double const scalar_ns = 1e9 * Elapsed(start) / (double(BENCHMARK_MATH_PASSES) * BENCHMARK_MATH_VALUES);
+
+	// array version
+	start = std::chrono::steady_clock::now();
+	for (int pass = 0; pass < BENCHMARK_MATH_PASSES; ++pass)
+	{
+		ARRAY(input, output, BENCHMARK_MATH_VALUES);
+		sum += output[pass & (BENCHMARK_MATH_VALUES - 1)];
+	}
+	double const array_ns = 1e9 * Elapsed(start) / (double(BENCHMARK_MATH_PASSES) * BENCHMARK_MATH_VALUES);
+
+	benchmark_sink = float(sum);
+
+	printf("%-10s  %15d  %14d  %10.2f  %10.2f\n", name, scalar_errors, array_errors, scalar_ns, array_ns);
+}
+
+// check the fast float-to-integer conversions
+static void BenchmarkConversions()
+{
+	printf("conversion  scalar mismatch  array mismatch   scalar ns    array ns\n");
+	BenchmarkConvert<RoundReference, RoundInt, RoundInt>("round");
+	BenchmarkConvert<FloorReference, FloorInt, FloorInt>("floor");
+	BenchmarkConvert<CeilingReference, CeilingInt, CeilingInt>("ceiling");
+	BenchmarkConvert<TruncateReference, TruncateInt, TruncateInt>("truncate");
+}
+
+// samples per wave measurement
+// (a power of two, so a phase step of a whole number of cycles over
+// the measurement is exact and every harmonic falls on one analysis bin)
+static size_t const BENCHMARK_WAVE_SAMPLES = 65536;
+
+// passes over the frequencies per wave timing
+static int const BENCHMARK_WAVE_PASSES = 10;
+
+// render a wave with a wave render function or a wave group function
+// (a group renders the same wave in every lane and keeps the first;
+// pre-roll renders one block before the output so corrections that
+// follow an edge (MinBLEP) carry over from the previous cycle as they
+// would in a periodic wave, at the cost of starting one block late in phase)
+static void BenchmarkWaveRender(NoteOscillatorConfig config, WaveRender const render, WaveRenderGroup const render_group, int const cycles, float output[], bool const preroll = false)
+{
+	static float spare_buffer[SIMD_WIDTH][BENCHMARK_BLOCK_SAMPLES];
+
+	// cycles of the output wave, which with hard sync is the sync cycle
+	config.frequency = float(cycles) * (config.sync_enable ? config.sync_phase : 1.0f);
+	float const step = 1.0f / BENCHMARK_WAVE_SAMPLES;
+	OscillatorState state[SIMD_WIDTH];
+	memset(output, 0, BENCHMARK_WAVE_SAMPLES * sizeof(float));
+
+	for (size_t start = preroll ? 0 : BENCHMARK_BLOCK_SAMPLES; start <= BENCHMARK_WAVE_SAMPLES; start += BENCHMARK_BLOCK_SAMPLES)
+	{
+		float * const buffer = start ? output + start - BENCHMARK_BLOCK_SAMPLES : spare_buffer[0];
+		if (render_group)
+		{
+			OscillatorGroup group;
+			float group_step[SIMD_WIDTH];
+			for (int lane = 0; lane < SIMD_WIDTH; ++lane)
+			{
+				group.state[lane] = &state[lane];
+				group.buffer[lane] = lane ? spare_buffer[lane] : buffer;
+				group_step[lane] = step;
+			}
+			group.Load(config, group_step);
+			render_group(config, group, BENCHMARK_BLOCK_SAMPLES);
+			group.Store(config, BENCHMARK_BLOCK_SAMPLES);
+		}
+		else
+		{
+			render(config, state[0], step, buffer, BENCHMARK_BLOCK_SAMPLES);
+		}
+	}
+}
+
+// time per oscillator sample for a wave render function or a wave group function
+static double BenchmarkWaveTime(NoteOscillatorConfig const &config, WaveRender const render, WaveRenderGroup const render_group, int const cycles[], int const frequencies)
+{
+	static float output[BENCHMARK_WAVE_SAMPLES];
+
+	std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+	for (int pass = 0; pass < BENCHMARK_WAVE_PASSES; ++pass)
+	{
+		for (int f = 0; f < frequencies; ++f)
+			BenchmarkWaveRender(config, render, render_group, cycles[f], output);
+	}
+	double const samples = double(BENCHMARK_WAVE_PASSES) * frequencies * BENCHMARK_WAVE_SAMPLES * (render_group ? SIMD_WIDTH : 1);
+	benchmark_sink = output[0];
+	return 1e9 * Elapsed(start) / samples;
+}
+
+// power of one analysis bin
+// (Goertzel algorithm)
+static double BenchmarkBinPower(float const input[], size_t const count, int const bin)
+{
+	double const coefficient = 2.0 * cos(2.0 * M_PI * bin / count);
+	double s1 = 0.0, s2 = 0.0;
+	for (size_t i = 0; i < count; ++i)
+	{
+		double const s0 = input[i] + coefficient * s1 - s2;
+		s2 = s1;
+		s1 = s0;
+	}
+	return s1 * s1 + s2 * s2 - coefficient * s1 * s2;
+}
+
+// cycles per sine wave measurement
+// (about 110 Hz, 1760 Hz, and 7040 Hz at 48 kHz)
+static int const BENCHMARK_SINE_CYCLES[] = { 150, 2400, 9600 };
+
+// the sine wave the way the synthesizer computed it before FastSine
+static float EvaluateLibrarySine(OscillatorConfig const &, OscillatorState &state, float)
+{
+	return sinf(M_PI * 2 * state.phase);
+}
+
+// the sine wave polynomial without the hard sync kernel
+static float EvaluatePolynomialSine(OscillatorConfig const &, OscillatorState &state, float)
+{
+	return FastSine(state.phase);
+}
+
+// measure a sine wave generator
+// (reports the worst signal-to-noise ratio against the double-precision
+// sine, the worst total harmonic distortion through the ninth harmonic,
+// and the time per oscillator sample)
+static void BenchmarkSineGenerator(char const *name, WaveRender const render, WaveRenderGroup const render_group)
+{
+	static float output[BENCHMARK_WAVE_SAMPLES];
+	NoteOscillatorConfig const config(true, WAVE_SINE);
+
+	double snr = DBL_MAX, thd = -DBL_MAX;
+	for (size_t f = 0; f < ARRAY_SIZE(BENCHMARK_SINE_CYCLES); ++f)
+	{
+		int const cycles = BENCHMARK_SINE_CYCLES[f];
+		BenchmarkWaveRender(config, render, render_group, cycles, output);
+
+		// noise against the exact sine
+		double signal = 0.0, noise = 0.0;
+		for (size_t i = 0; i < BENCHMARK_WAVE_SAMPLES; ++i)
+		{
+			double const reference = sin(2.0 * M_PI * double((i * cycles) % BENCHMARK_WAVE_SAMPLES) / BENCHMARK_WAVE_SAMPLES);
+			signal += reference * reference;
+			noise += (output[i] - reference) * (output[i] - reference);
+		}
+		snr = Min(snr, 10.0 * log10(signal / Max(noise, DBL_MIN)));
+
+		// harmonics below the Nyquist frequency
+		double harmonics = 0.0;
+		for (int h = 2; h <= 9 && h * cycles < int(BENCHMARK_WAVE_SAMPLES / 2); ++h)
+			harmonics += BenchmarkBinPower(output, BENCHMARK_WAVE_SAMPLES, h * cycles);
+		double const fundamental = BenchmarkBinPower(output, BENCHMARK_WAVE_SAMPLES, cycles);
+		thd = Max(thd, 10.0 * log10(Max(harmonics, DBL_MIN) / fundamental));
+	}
+
+	double const sample_ns = BenchmarkWaveTime(config, render, render_group, BENCHMARK_SINE_CYCLES, ARRAY_SIZE(BENCHMARK_SINE_CYCLES));
+
+	printf("%-16s  %7.1f  %7.1f  %12.2f\n", name, snr, thd, sample_ns);
+}
+
+// measure the sine wave generators
+// (the library sine the oscillator used to call, the polynomial used with
+// hard sync and by the LFO, and the quadrature oscillators used without sync)
+static void BenchmarkSine()
+{
+	printf("sine wave          SNR dB   THD dB  ns per sample\n");
+	BenchmarkSineGenerator("libm sinf", OscillatorKernel<EvaluateLibrarySine, false, false>, NULL);
+	BenchmarkSineGenerator("polynomial", OscillatorKernel<EvaluatePolynomialSine, false, false>, NULL);
+	BenchmarkSineGenerator("quadrature", sine_render[1][0][0], NULL);
+	BenchmarkSineGenerator("quadrature group", NULL, sine_render_group[1]);
+}
+
+// cycles per antialiasing measurement
+// (odd, so no alias lands on a harmonic; about 880 Hz, 3520 Hz, and 7040 Hz at 48 kHz)
+static int const BENCHMARK_ALIAS_CYCLES[] = { 1201, 4801, 9601 };
+
+// measure one antialiasing method for one wave type
+// (reports the worst power aliased below the Nyquist frequency relative
+// to the fundamental, and the time per oscillator sample)
+static void BenchmarkAntialiasMethod(NoteOscillatorConfig const &config, char const *name, WaveRender const render, WaveRenderGroup const render_group)
+{
+	static float output[BENCHMARK_WAVE_SAMPLES];
+	int const nyquist = int(BENCHMARK_WAVE_SAMPLES / 2);
+
+	double alias = -DBL_MAX;
+	for (size_t f = 0; f < ARRAY_SIZE(BENCHMARK_ALIAS_CYCLES); ++f)
+	{
+		int const cycles = BENCHMARK_ALIAS_CYCLES[f];
+		BenchmarkWaveRender(config, render, render_group, cycles, output, true);
+
+		// total power in every bin (Parseval's theorem)
+		double sum = 0.0, sum_squares = 0.0;
+		for (size_t i = 0; i < BENCHMARK_WAVE_SAMPLES; ++i)
+		{
+			sum += output[i];
+			sum_squares += double(output[i]) * output[i];
+		}
+		double power = BENCHMARK_WAVE_SAMPLES * sum_squares - sum * sum;
+
+		// everything but the harmonics below the Nyquist frequency is alias
+		// (including images from wavetable interpolation)
+		for (int h = 1; h * cycles < nyquist; ++h)
+			power -= 2.0 * BenchmarkBinPower(output, BENCHMARK_WAVE_SAMPLES, h * cycles);
+		double const fundamental = 2.0 * BenchmarkBinPower(output, BENCHMARK_WAVE_SAMPLES, cycles);
+		alias = Max(alias, 10.0 * log10(Max(power, DBL_MIN) / fundamental));
+	}
+
+	double const sample_ns = BenchmarkWaveTime(config, render, render_group, BENCHMARK_ALIAS_CYCLES, ARRAY_SIZE(BENCHMARK_ALIAS_CYCLES));
+
+	printf("%-9s %-16s  %8.1f  %12.2f\n", wave_name[config.wavetype], name, alias, sample_ns);
+}
+
+// measure the antialiasing methods for the wave types with wavetables
+static void BenchmarkAntialias()
+{
+	static Wave const wave[] = { WAVE_PULSE, WAVE_SAWTOOTH, WAVE_TRIANGLE };
+
+	printf("wave      method            alias dB  ns per sample\n");
+	for (size_t w = 0; w < ARRAY_SIZE(wave); ++w)
+	{
+		// pulse width away from a square wave to keep the even harmonics
+		NoteOscillatorConfig const config(true, wave[w], 0.3f);
+		BenchmarkAntialiasMethod(config, "none", wave_render[wave[w]][0][0][0], NULL);
+		BenchmarkAntialiasMethod(config, "PolyBLEP", wave_render[wave[w]][1][0][0], NULL);
+		BenchmarkAntialiasMethod(config, "PolyBLEP group", NULL, wave_render_group[wave[w]][1]);
+		if (wave_minblep_render[wave[w]])
+			BenchmarkAntialiasMethod(config, "MinBLEP", wave_minblep_render[wave[w]][0][0], NULL);
+		BenchmarkAntialiasMethod(config, "wavetable", wave_table_render[wave[w]][0], NULL);
+
+		// hard sync adds a step at the sync phase
+		// (a half cycle past the end of a whole cycle)
+		if (wave_minblep_render[wave[w]])
+		{
+			NoteOscillatorConfig sync_config(config);
+			sync_config.sync_enable = true;
+			sync_config.sync_phase = 1.5f;
+			BenchmarkAntialiasMethod(sync_config, "none sync", wave_render[wave[w]][0][1][0], NULL);
+			BenchmarkAntialiasMethod(sync_config, "PolyBLEP sync", wave_render[wave[w]][1][1][0], NULL);
+			BenchmarkAntialiasMethod(sync_config, "MinBLEP sync", wave_minblep_render[wave[w]][1][0], NULL);
+		}
+	}
+}
+
+// compare the wave group functions with the scalar wave functions
+// (reports the largest difference in any sample against the tolerance,
+// and the time per oscillator sample of each)
+static void BenchmarkGroups()
+{
+	static float scalar_output[BENCHMARK_WAVE_SAMPLES];
+	static float group_output[BENCHMARK_WAVE_SAMPLES];
+
+	printf("wave      antialias  max difference  tolerance   scalar ns    group ns\n");
+	for (int w = 0; w < WAVE_COUNT; ++w)
+	{
+		if (!wave_render_group[w])
+			continue;
+		for (int antialias = 0; antialias < 2; ++antialias)
+		{
+			NoteOscillatorConfig const config(true, Wave(w), 0.3f);
+			WaveRender const render = wave_render[w][antialias][0][0];
+			WaveRenderGroup const render_group = wave_render_group[w][antialias];
+
+			// the same wave with frequency and wave parameter ramping
+			// across each block as LFO modulation does
+			// (the wave parameter ramps past 1 to reach the constant pulse)
+			NoteOscillatorConfig ramp(config);
+			ramp.frequency_step = 0.25f;
+			ramp.waveparam_step = 0.8f / BENCHMARK_BLOCK_SAMPLES;
+
+			float difference = 0.0f;
+			for (size_t f = 0; f < ARRAY_SIZE(BENCHMARK_ALIAS_CYCLES); ++f)
+			{
+				BenchmarkWaveRender(config, render, NULL, BENCHMARK_ALIAS_CYCLES[f], scalar_output);
+				BenchmarkWaveRender(config, NULL, render_group, BENCHMARK_ALIAS_CYCLES[f], group_output);
+				for (size_t i = 0; i < BENCHMARK_WAVE_SAMPLES; ++i)
+					difference = Max(difference, fabsf(group_output[i] - scalar_output[i]));
+
+				BenchmarkWaveRender(ramp, render, NULL, BENCHMARK_ALIAS_CYCLES[f], scalar_output);
+				BenchmarkWaveRender(ramp, NULL, render_group, BENCHMARK_ALIAS_CYCLES[f], group_output);
+				for (size_t i = 0; i < BENCHMARK_WAVE_SAMPLES; ++i)
+					difference = Max(difference, fabsf(group_output[i] - scalar_output[i]));
+			}
+
+			double const scalar_ns = BenchmarkWaveTime(config, render, NULL, BENCHMARK_ALIAS_CYCLES, ARRAY_SIZE(BENCHMARK_ALIAS_CYCLES));
+			double const group_ns = BenchmarkWaveTime(config, NULL, render_group, BENCHMARK_ALIAS_CYCLES, ARRAY_SIZE(BENCHMARK_ALIAS_CYCLES));
+
+			printf("%-9s %-9s  %14.2g  %-9s  %10.2f  %10.2f\n", wave_name[w], antialias ? "PolyBLEP" : "none", difference,
+				difference <= OSCILLATOR_GROUP_TOLERANCE ? "ok" : "EXCEEDED", scalar_ns, group_ns);
+		}
+	}
+}
+
+// measure the cost of synthesizer components and print a report
+int BenchmarkReport(int argc, char **argv)
+{
+	// output sample rate
+	render_frequency = argc > 0 ? atoi(argv[0]) : 48000;
+	if (render_frequency == 0)
+	{
+		fprintf(stderr, "Invalid sample rate \"%s\"\n", argv[0]);
+		return 1;
+	}
+	float const step = 1.0f / render_frequency;
+
+	// initialize filter coefficient tables
+	InitFilter();
+
+	// initialize band-limited wavetables
+	InitAntialiasMethod(ANTIALIAS_METHOD_WAVETABLE);
+
+	// initialize the MinBLEP step residual table
+	InitAntialiasMethod(ANTIALIAS_METHOD_MINBLEP);
+
+	// match the rendering environment
+	unsigned int const prev = FlushDenormals();
+
+	printf("benchmark at %u Hz, %d lanes per filter bank\n\n", render_frequency, FILTER_LANES);
+	BenchmarkFilters(step);
+	printf("\n");
+	BenchmarkMath();
+	printf("\n");
+	BenchmarkConversions();
+	printf("\n");
+	BenchmarkSine();
+	printf("\n");
+	BenchmarkAntialias();
+	printf("\n");
+	BenchmarkGroups();
+
+	RestoreDenormals(prev);
+
+	return 0;
+}
@@ -0,0 +1,12 @@
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Benchmark Report
+*/
+
+// measure the cost of synthesizer components and print a report
+// arguments: [sample rate]
+// (returns the process exit code)
+extern int BenchmarkReport(int argc, char **argv);
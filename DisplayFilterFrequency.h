@@ -1,13 +1,13 @@
-#pragma once
-/*
-MINI VIRTUAL ANALOG SYNTHESIZER
-Copyright 2014 Kenneth D. Miller III
-
-Filter Frequency Display
-*/
-
-class DisplayFilterFrequency
-{
-public:
-	void Update(HANDLE hOut, int const v);
-};
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Filter Frequency Display
+*/
+
+class DisplayFilterFrequency
+{
+public:
+	void Update(HANDLE hOut, int const v);
+};
@@ -1,13 +1,13 @@
-#pragma once
-/*
-MINI VIRTUAL ANALOG SYNTHESIZER
-Copyright 2014 Kenneth D. Miller III
-
-Low-Frequency Oscillator Display
-*/
-
-class DisplayLowFrequencyOscillator
-{
-public:
-	void Update(HANDLE hOut);
-};
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Low-Frequency Oscillator Display
+*/
+
+class DisplayLowFrequencyOscillator
+{
+public:
+	void Update(HANDLE hOut);
+};
@@ -1,13 +1,13 @@
-#pragma once
-/*
-MINI VIRTUAL ANALOG SYNTHESIZER
-Copyright 2014 Kenneth D. Miller III
-
-Oscillator Frequency Display
-*/
-
-class DisplayOscillatorFrequency
-{
-public:
-	void Update(HANDLE hOut, int const v, int const o);
-};
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Oscillator Frequency Display
+*/
+
+class DisplayOscillatorFrequency
+{
+public:
+	void Update(HANDLE hOut, int const v, int const o);
+};
@@ -1,118 +1,256 @@
-/*
-MINI VIRTUAL ANALOG SYNTHESIZER
-Copyright 2014 Kenneth D. Miller III
-
-Envelope Generator
-*/
-#include "StdAfx.h"
-
-#include "Envelope.h"
-#include "Math.h"
-#include "Voice.h"
-
-// envelope bias values to make the exponential decay arrive in finite time
-// the attack part is set up to be more linear (and shorter) than the decay/release part
-static const float ENV_ATTACK_CONSTANT = 1.0f;
-static const float ENV_DECAY_CONSTANT = 3.0f;
-static float const ENV_ATTACK_BIAS = 1.0f / (1.0f - expf(-ENV_ATTACK_CONSTANT)) - 1.0f;
-static float const ENV_DECAY_BIAS = 1.0f - 1.0f / (1.0f - expf(-ENV_DECAY_CONSTANT));
-
-// envelope config constructor
-EnvelopeConfig::EnvelopeConfig(bool const enable, float const attack_time, float const decay_time, float const sustain_level, float const release_time)
-: enable(enable)
-, attack_time(attack_time)
-, attack_rate(1 / (attack_time + FLT_MIN))
-, decay_time(decay_time)
-, decay_rate(1 / (decay_time + FLT_MIN))
-, sustain_level(sustain_level)
-, release_time(release_time)
-, release_rate(1 / (release_time + FLT_MIN))
-{
-}
-
-// envelope state constructor
-EnvelopeState::EnvelopeState()
-: gate(false)
-, state(OFF)
-, amplitude(0.0f)
-{
-}
-
-// gate envelope generator
-void EnvelopeState::Gate(EnvelopeConfig const &config, bool on)
-{
-	if (gate == on)
-		return;
-
-	gate = on;
-	if (gate)
-	{
-		if (config.enable && config.attack_time)
-			state = EnvelopeState::ATTACK;
-		else if (config.enable && config.decay_time)
-			state = EnvelopeState::DECAY, amplitude = 1;
-		else
-			state = EnvelopeState::SUSTAIN, amplitude = config.sustain_level;
-	}
-	else
-	{
-		if (config.enable && config.release_time)
-			state = EnvelopeState::RELEASE;
-		else
-			state = EnvelopeState::OFF, amplitude = 0;
-	}
-}
-
-// update envelope generator
-float EnvelopeState::Update(EnvelopeConfig const &config, float const step)
-{
-	if (!config.enable)
-		return gate;
-	float env_target;
-	switch (state)
-	{
-	case ATTACK:
-		env_target = 1.0f + ENV_ATTACK_BIAS;
-		amplitude += (env_target - amplitude) * config.attack_rate * step;
-		if (amplitude >= 1.0f)
-		{
-			amplitude = 1.0f;
-			if (config.sustain_level < 1.0f)
-				state = DECAY;
-			else
-				state = SUSTAIN;
-		}
-		break;
-
-	case DECAY:
-		env_target = config.sustain_level + (1.0f - config.sustain_level) * ENV_DECAY_BIAS;
-		amplitude += (env_target - amplitude) * config.decay_rate * step;
-		if (amplitude <= config.sustain_level)
-		{
-			amplitude = config.sustain_level;
-			state = SUSTAIN;
-		}
-		break;
-
-	case RELEASE:
-		env_target = ENV_DECAY_BIAS;
-		if (amplitude <= config.sustain_level || config.decay_rate < config.release_rate)
-		{
-			amplitude += (env_target - amplitude) * config.release_rate * step;
-		}
-		else
-		{
-			amplitude += (env_target - amplitude) * config.decay_rate * step;
-			if (amplitude <= config.sustain_level)
-				amplitude = config.sustain_level;
-		}
-		if (amplitude <= 0.0f)
-		{
-			amplitude = 0.0f;
-			state = OFF;
-		}
-		break;
-	}
-
-	return amplitude;
-}
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Envelope Generator
+*/
+#include "Platform.h"
+
+#include "Envelope.h"
+#include "Math.h"
+#include "Voice.h"
+
+// envelope bias values to make the exponential decay arrive in finite time
+// the attack part is set up to be more linear (and shorter) than the decay/release part
+static const float ENV_ATTACK_CONSTANT = 1.0f;
+static const float ENV_DECAY_CONSTANT = 3.0f;
+static float const ENV_ATTACK_BIAS = 1.0f / (1.0f - expf(-ENV_ATTACK_CONSTANT)) - 1.0f;
+static float const ENV_DECAY_BIAS = 1.0f - 1.0f / (1.0f - expf(-ENV_DECAY_CONSTANT));
+
+// envelope config constructor
+EnvelopeConfig::EnvelopeConfig(bool const enable, float const attack_time, float const decay_time, float const sustain_level, float const release_time)
+: enable(enable)
+, attack_time(attack_time)
+, attack_rate(1 / (attack_time + FLT_MIN))
+, decay_time(decay_time)
+, decay_rate(1 / (decay_time + FLT_MIN))
+, sustain_level(sustain_level)
+, release_time(release_time)
+, release_rate(1 / (release_time + FLT_MIN))
+{
+}
+
+// envelope state constructor
+EnvelopeState::EnvelopeState()
+: gate(false)
+, state(OFF)
+, amplitude(0.0f)
+{
+}
+
+// gate envelope generator
+void EnvelopeState::Gate(EnvelopeConfig const &config, bool on)
+{
+	if (gate == on)
+		return;
+
+	gate = on;
+	if (gate)
+	{
+		if (config.enable && config.attack_time)
+			state = EnvelopeState::ATTACK;
+		else if (config.enable && config.decay_time)
+			state = EnvelopeState::DECAY, amplitude = 1;
+		else
+			state = EnvelopeState::SUSTAIN, amplitude = config.sustain_level;
+	}
+	else
+	{
+		if (config.enable && config.release_time)
+			state = EnvelopeState::RELEASE;
+		else
+			state = EnvelopeState::OFF, amplitude = 0;
+	}
+}
+
+// segment length for a target the amplitude never passes
+static size_t const ENV_FOREVER = ~size_t(0) / 2;
+
+// exponential segment heading for a biased target
+// amplitude after n samples = target + (amplitude - target) * (1 - rate * step)^n
+struct EnvelopeSegment
+{
+	float target;
+	float rate;
+	float level;	// the segment ends when the amplitude passes this
+	bool rising;
+};
+
+// get the current segment
+// (returns false if the amplitude is constant)
+static bool GetSegment(EnvelopeConfig const &config, EnvelopeState const &state, EnvelopeSegment &segment)
+{
+	switch (state.state)
+	{
+	case EnvelopeState::ATTACK:
+		segment.target = 1.0f + ENV_ATTACK_BIAS;
+		segment.rate = config.attack_rate;
+		segment.level = 1.0f;
+		segment.rising = true;
+		return true;
+
+	case EnvelopeState::DECAY:
+		segment.target = config.sustain_level + (1.0f - config.sustain_level) * ENV_DECAY_BIAS;
+		segment.rate = config.decay_rate;
+		segment.level = config.sustain_level;
+		segment.rising = false;
+		return true;
+
+	case EnvelopeState::RELEASE:
+		// release from above the sustain level falls at the decay rate
+		// until it reaches the sustain level if that is faster
+		segment.target = ENV_DECAY_BIAS;
+		segment.rising = false;
+		if (state.amplitude <= config.sustain_level || config.decay_rate < config.release_rate)
+		{
+			segment.rate = config.release_rate;
+			segment.level = 0.0f;
+		}
+		else
+		{
+			segment.rate = config.decay_rate;
+			segment.level = config.sustain_level;
+		}
+		return true;
+
+	default:
+		return false;
+	}
+}
+
+// move to the next stage at the end of the current segment
+static void EndSegment(EnvelopeConfig const &config, EnvelopeState &state, EnvelopeSegment const &segment)
+{
+	state.amplitude = segment.level;
+	switch (state.state)
+	{
+	case EnvelopeState::ATTACK:
+		if (config.sustain_level < 1.0f)
+			state.state = EnvelopeState::DECAY;
+		else
+			state.state = EnvelopeState::SUSTAIN;
+		break;
+
+	case EnvelopeState::DECAY:
+		state.state = EnvelopeState::SUSTAIN;
+		break;
+
+	case EnvelopeState::RELEASE:
+		if (state.amplitude <= 0.0f)
+		{
+			state.amplitude = 0.0f;
+			state.state = EnvelopeState::OFF;
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+// number of samples until the amplitude passes the segment's level
+// (including the sample where it does)
+static size_t SegmentLength(EnvelopeSegment const &segment, float const amplitude, float const step)
+{
+	double const rate_step = double(segment.rate) * step;
+	if (rate_step >= 1.0 || (segment.rising ? amplitude >= segment.level : amplitude <= segment.level))
+		return 1;
+	double const ratio = double(segment.level - segment.target) / double(amplitude - segment.target);
+	if (ratio >= 1.0)
+		return 1;
+	if (ratio <= 0.0)
+		return ENV_FOREVER;
+	double const length = ceil(log(ratio) / log1p(-rate_step));
+	return length < double(ENV_FOREVER) ? Max(size_t(length), size_t(1)) : ENV_FOREVER;
+}
+
+// render per-sample amplitudes
+// (each segment runs without stage checks until shortly before
+// the sample where it is predicted to end)
+size_t EnvelopeState::Render(EnvelopeConfig const &config, float const step, float buffer[], size_t const count)
+{
+	if (!config.enable)
+	{
+		if (state == OFF)
+			return 0;
+		float const value = float(gate);
+		for (size_t i = 0; i < count; ++i)
+			buffer[i] = value;
+		return count;
+	}
+
+	size_t i = 0;
+	while (i < count)
+	{
+		EnvelopeSegment segment;
+		if (!GetSegment(config, *this, segment))
+		{
+			// off or sustaining
+			if (state == OFF)
+				return i;
+			for (; i < count; ++i)
+				buffer[i] = amplitude;
+			break;
+		}
+
+		// samples that cannot reach the end of the segment
+		// (with a margin for rounding in the prediction)
+		size_t const length = SegmentLength(segment, amplitude, step);
+		size_t const margin = 2 + length / 1024;
+		size_t const bulk = i + Min(length > margin ? length - margin : 0, count - i);
+		for (; i < bulk; ++i)
+		{
+			amplitude += (segment.target - amplitude) * segment.rate * step;
+			buffer[i] = amplitude;
+		}
+
+		// samples near the end of the segment
+		for (; i < count; ++i)
+		{
+			amplitude += (segment.target - amplitude) * segment.rate * step;
+			if (segment.rising ? amplitude >= segment.level : amplitude <= segment.level)
+			{
+				EndSegment(config, *this, segment);
+				buffer[i] = amplitude;
+				if (state == OFF)
+					return i;
+				++i;
+				break;
+			}
+			buffer[i] = amplitude;
+		}
+	}
+
+	return count;
+}
+
+// advance by a number of samples
+// (evaluates each segment in closed form)
+float EnvelopeState::Advance(EnvelopeConfig const &config, float const step, size_t count)
+{
+	if (!config.enable)
+		return gate;
+
+	while (count > 0)
+	{
+		EnvelopeSegment segment;
+		if (!GetSegment(config, *this, segment))
+			break;
+
+		size_t const length = SegmentLength(segment, amplitude, step);
+		if (count < length)
+		{
+			// per-block multiplicative coefficient
+			float const coefficient = float(exp(double(count) * log1p(-double(segment.rate) * step)));
+			amplitude = segment.target + (amplitude - segment.target) * coefficient;
+			if (segment.rising ? amplitude >= segment.level : amplitude <= segment.level)
+				amplitude = segment.level;
+			break;
+		}
+
+		EndSegment(config, *this, segment);
+		count -= length;
+	}
+
+	return amplitude;
+}
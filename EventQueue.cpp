@@ -0,0 +1,134 @@
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Event Queue
+*/
+#include "Platform.h"
+
+#include "EventQueue.h"
+#include "Render.h"
+
+#include <atomic>
+#include <chrono>
+
+// events per queue
+// (must be a power of two)
+static unsigned int const EVENT_QUEUE_SIZE = 1024;
+
+// single-producer single-consumer ring buffer
+// (the producer only writes tail and the consumer only writes head;
+// both count up forever and wrap through the mask)
+struct EventQueue
+{
+	Event event[EVENT_QUEUE_SIZE];
+	std::atomic<unsigned int> head;
+	std::atomic<unsigned int> tail;
+};
+static EventQueue event_queue[EVENT_SOURCE_COUNT];
+
+// steady clock time of render sample zero
+static std::atomic<long long> event_origin(0);
+
+// scheduling delay in samples
+// (the length of the most recent render)
+static std::atomic<unsigned int> event_delay(0);
+
+// set once the render clock has been published
+static std::atomic<bool> event_synced(false);
+
+bool EventPush(int source, Event const &event)
+{
+	EventQueue &queue = event_queue[source];
+	unsigned int const tail = queue.tail.load(std::memory_order_relaxed);
+	if (tail - queue.head.load(std::memory_order_acquire) >= EVENT_QUEUE_SIZE)
+		return false;
+	queue.event[tail & (EVENT_QUEUE_SIZE - 1)] = event;
+	queue.tail.store(tail + 1, std::memory_order_release);
+	return true;
+}
+
+bool EventPushNow(int source, int type, int data1, int data2)
+{
+	Event const event = { EventTimeNow(), type, data1, data2 };
+	return EventPush(source, event);
+}
+
+// find the queue with the earliest pending event
+// (returns -1 if all queues are empty)
+static int EventEarliest()
+{
+	int earliest = -1;
+	unsigned long long time = 0;
+	for (int s = 0; s < EVENT_SOURCE_COUNT; ++s)
+	{
+		EventQueue const &queue = event_queue[s];
+		unsigned int const head = queue.head.load(std::memory_order_relaxed);
+		if (head == queue.tail.load(std::memory_order_acquire))
+			continue;
+		Event const &event = queue.event[head & (EVENT_QUEUE_SIZE - 1)];
+		if (earliest < 0 || event.time < time)
+		{
+			earliest = s;
+			time = event.time;
+		}
+	}
+	return earliest;
+}
+
+bool EventPeek(unsigned long long &time)
+{
+	int const s = EventEarliest();
+	if (s < 0)
+		return false;
+	EventQueue const &queue = event_queue[s];
+	time = queue.event[queue.head.load(std::memory_order_relaxed) & (EVENT_QUEUE_SIZE - 1)].time;
+	return true;
+}
+
+bool EventNext(unsigned long long before, Event &event)
+{
+	int const s = EventEarliest();
+	if (s < 0)
+		return false;
+	EventQueue &queue = event_queue[s];
+	unsigned int const head = queue.head.load(std::memory_order_relaxed);
+	Event const &next = queue.event[head & (EVENT_QUEUE_SIZE - 1)];
+	if (next.time >= before)
+		return false;
+	event = next;
+	queue.head.store(head + 1, std::memory_order_release);
+	return true;
+}
+
+// steady clock time in clock ticks
+static inline long long EventClockNow()
+{
+	return std::chrono::steady_clock::now().time_since_epoch().count();
+}
+
+// seconds per steady clock tick
+static double const EVENT_CLOCK_PERIOD = double(std::chrono::steady_clock::period::num) / std::chrono::steady_clock::period::den;
+
+void EventSync(unsigned long long position, size_t count)
+{
+	// time the clock would have been at sample zero
+	long long const origin = EventClockNow() - (long long)(position / (render_frequency * EVENT_CLOCK_PERIOD));
+	event_origin.store(origin, std::memory_order_relaxed);
+	event_delay.store((unsigned int)count, std::memory_order_relaxed);
+	event_synced.store(true, std::memory_order_release);
+}
+
+unsigned long long EventTimeNow()
+{
+	// before the first render everything happens at the start
+	if (!event_synced.load(std::memory_order_acquire))
+		return 0;
+
+	// delay events by one render so that they keep their relative timing
+	// instead of snapping to the start of whichever render picks them up
+	long long const elapsed = EventClockNow() - event_origin.load(std::memory_order_relaxed);
+	if (elapsed < 0)
+		return 0;
+	return (unsigned long long)(elapsed * EVENT_CLOCK_PERIOD * render_frequency) + event_delay.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,61 @@
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Event Queue
+(timed note and controller events passed to the audio thread)
+*/
+
+// event types
+enum EventType
+{
+	EVENT_NOTE_OFF,				// data1=note data2=velocity
+	EVENT_NOTE_ON,				// data1=note data2=velocity
+	EVENT_ALL_SOUND_OFF,
+	EVENT_ALL_NOTES_OFF,
+	EVENT_RESET_CONTROLLERS,
+	EVENT_PITCH_WHEEL,			// data1=value
+	EVENT_COUNT
+};
+
+// event sources
+// (each source has its own queue with exactly one producer thread)
+enum EventSource
+{
+	EVENT_SOURCE_KEYS,			// main thread: computer keyboard or offline note list
+	EVENT_SOURCE_MIDI,			// midi input driver thread
+	EVENT_SOURCE_COUNT
+};
+
+// timed event
+struct Event
+{
+	unsigned long long time;	// render sample position
+	int type;
+	int data1;
+	int data2;
+};
+
+// add an event to a source's queue
+// (producer only; returns false if the queue is full)
+extern bool EventPush(int source, Event const &event);
+
+// add an event at the current time to a source's queue
+// (producer only; returns false if the queue is full)
+extern bool EventPushNow(int source, int type, int data1 = 0, int data2 = 0);
+
+// get the time of the earliest pending event
+// (consumer only; returns false if all queues are empty)
+extern bool EventPeek(unsigned long long &time);
+
+// remove the earliest pending event if it comes before the given time
+// (consumer only; returns false if there is no such event)
+extern bool EventNext(unsigned long long before, Event &event);
+
+// publish the render sample clock at the start of a render
+// (consumer only; producers schedule events one render ahead of it)
+extern void EventSync(unsigned long long position, size_t count);
+
+// render sample position for an event happening now
+extern unsigned long long EventTimeNow();
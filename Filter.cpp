@@ -1,432 +1,789 @@
-/*
-MINI VIRTUAL ANALOG SYNTHESIZER
-Copyright 2014 Kenneth D. Miller III
-
-Filter
-*/
-#include "StdAfx.h"
-
-#include "Filter.h"
-#include "Envelope.h"
-#include "Math.h"
-#include "Voice.h"
-
-// cubic saturation function
-float CubicSaturate(float const x)
-{
-	if (x >= 1.5f)
-		return 1;
-	if (x <= -1.5f)
-		return -1;
-	return x - 0.14814814814814814814814814814815f * x * x * x;
-}
-
-// filter saturation type
-#define SATURATE_FEEDBACK 0	// saturate feedback path
-#define SATURATE_INPUT 1	// saturate input after feedback
-// saturating input makes the filter work more like a hardware analog filter,
-// adding harmonics to higher-amplitude input signals for an "overdrive" effect
-#define SATURATE SATURATE_INPUT
-
-// saturation function to apply
-// (arranged from cheapest to costliest)
-//#define Saturate(x) (x)
-//#define Saturate(x) Clamp(x, -1.0f, 1.0f)
-//#define Saturate(x) CubicSaturate(x)
-#define Saturate(x) FastTanh(x)
-//#define Saturate(x) tanhf(x)
-
-// compensate for reduced gain at low frequencies as resonance increases
-// 0.0: no compensation, -12dB at low frequencies
-// 0.5: half compensation, -6dB at low frequencies
-// 1.0: full compensation, -0dB at low frequencies
-static float const GAIN_COMPENSATION = 0.5f;
-
-// filter configuration
-FilterConfig flt_config(false, FilterConfig::LOWPASS_4, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f);
-
-// filter envelope config
-EnvelopeConfig flt_env_config(false, 0.0f, 1.0f, 0.0f, 0.1f);
-
-// filter envelope state
-EnvelopeState flt_env_state[VOICES];
-
-// filter mode names
-char const * const filter_name[FilterConfig::COUNT] =
-{
-	"Peak",
-	"Low-Pass 1",
-	"Low-Pass 2",
-	"Low-Pass 3",
-	"Low-Pass 4",
-	"High-Pass 1",
-	"High-Pass 2",
-	"High-Pass 3",
-	"High-Pass 4",
-	"Band-Pass 1",
-	"Band 1 + Low 1",
-	"Band 1 + Low 2",
-	"Band 1 + High 1",
-	"Band 1 + High 2",
-	"Band-Pass 2",
-	"Notch 1",
-	"Notch 1 + Low 1",
-	"Notch 1 + Low 2",
-	"Notch 1 + High 1",
-	"Notch 1 + High 2",
-	"Notch 2",
-	"Phase Shift 1",
-	"Phase Shift 2",
-	"Phase Shift 3",
-	"Phase Shift 4",
-};
-
-// The Oberheim Xpander and Matrix-12 analog synthesizers use a typical four-
-// stage low-pass filter but combine voltages from each stage to produce 15
-// different filter modes.  The publication describing the Improved Moog Filter
-// mentioned this but gave no details.
-
-// The circuit diagram on page 4 of the Oberheim Matrix-12 Service Manual
-// shows how the filter works:
-// http://elektrotanya.com/oberheim_matrix-12_sm.pdf/download.html
-
-// The first three bits of the filter mode select one of eight resistor
-// networks that combine the stage voltages in various ways.  The fourth
-// bit disables the first filter stage.
-
-// The mixing values below were derived from the resistor networks in the
-// circuit diagram.  The IIR digital filter has an additional stage output
-// to work with and no hard restriction on the number of options so there
-// are several more filter options here than on the Oberheim synthesizers.
-
-// Also: http://www.kvraudio.com/forum/viewtopic.php?p=3821632
-
-// Creating Filters
-
-// Use stage output directly for a 1-pole low-pass filter:
-// LP(1) = y[1]
-
-// Subtract stage output from stage input for a 1-pole high-pass filter"
-// HP(1) = y[0] - y[1]
-
-// Add coefficient vectors (+) to apply filters in parallel:
-// Filter A: a0, a1, a2, a3, a4
-// Filter B: b0, b1, b2, b3, b4
-// Filter A + B: a0 + b0, a1 + b2, a2 + b2, a3 + b3, a4 + b4
-
-// Scale coefficient vector (*) to scale filter output:
-// Filter A: a0, a1, a2, a3, a4
-// Scale: s
-// Filter A * s: a0 * s, a1 * s, a2 * s, a3 * s, a4 * s
-
-// Convolve coefficient vectors (*) to apply filters in series:
-// Filter A: a0, a1, a2, a3, a4
-// Filter B: b0, b1, b2, b3, b4
-// Filter A * B:
-//		a0 * b0,
-//		a0 * b1 + a1 * b0,
-//		a0 * b2 + a1 * b1 + a2 * b0,
-//		a0 * b3 + a1 * b2 + a2 * b1 + a3 * b0,
-//		a0 * b4 + a1 * b3 + a2 * b2 + a3 * b1 + a4 * b0
-
-// Band-pass is a low-pass and high-pass in series:
-// BP(1) = HP(1) * LP(1) or LP(1) * HP(1) = y[1] - 2 y[2]
-
-// 1-Pole Low-Pass phase shift: -atan(frequency/cutoff)
-// 0 degrees at low frequencies
-// -45 degrees at the cutoff frequency
-// -90 degrees at high frequencies
-
-// 1-Pole High-Pass phase shift: pi/2 - atan(frequency/cutoff)
-// +90 degrees at low frequencies
-// +45 degrees at the cutoff frequency
-// 0 degrees at high frequencies
-
-// Filters in series combine phase shifts
-// 4P Band-Pass = 2P Low-Pass * 2P High-Pass = pi - 4 atan(frequency/cutoff))
-
-// Filters in parallel add signals
-// 2P Notch = 2P Low-Pass + 2P High-Pass
-// 2P Phase-Shift = 2P Low-Pass - 2P High-Pass
-// 2P Low-Pass phase shift: -2 atan(frequency/cutoff)
-// 2P High-Pass phase shift: pi - 2 atan(frequency/cutoff)
-// Signals are 180 degrees out of phase so they have opposite signs
-// 2P Notch adds the signals so they cancel each other
-// 2P Phase-Shift subtracts the signals so they reinforce each other
-
-// filter stage coefficients for each filter mode
-static float const filter_mix[FilterConfig::COUNT][5] =
-{
-	//y0 y1 y2 y3 y4 
-	{ 1, 0, 0, 0, 0 },		// PEAK,					// input with feedback term
-	{ 0, 1, 0, 0, 0 },		// LOWPASS_1,				// LP(1) = y[1]
-	{ 0, 0, 1, 0, 0 },		// LOWPASS_2,				// LP(2) = LP(1) * LP(1) = y[2]
-	{ 0, 0, 0, 1, 0 },		// LOWPASS_3,				// LP(3) = LP(2) * LP(1) = y[3]
-	{ 0, 0, 0, 0, 1 },		// LOWPASS_4,				// LP(4) = LP(3) * LP(1) = y[4]
-	{ 1, -1, 0, 0, 0 },		// HIGHPASS_1,				// HP(1) = y[0] - y[1]
-	{ 1, -2, 1, 0, 0 },		// HIGHPASS_2,				// HP(2) = HP(1) * HP(1)
-	{ 1, -3, 3, -1, 0 },	// HIGHPASS_3,				// HP(3) = HP(2) * HP(1)
-	{ 1, -4, 6, -4, 1 },	// HIGHPASS_4,				// HP(4) = HP(3) * HP(1)
-	{ 0, 2, -2, 0, 0 },		// BANDPASS_1,				// BP(1) = LP(1) * HP(1) * 2
-	{ 0, 0, 2, -2, 0 },		// BANDPASS_1_LOWPASS_1,	// BP(1) * LP(1)
-	{ 0, 0, 0, 2, -2 },		// BANDPASS_1_LOWPASS_2,	// BP(1) * LP(2)
-	{ 0, 2, -4, 2, 0 },		// BANDPASS_1_HIGHPASS_1,	// BP(1) * HP(1)
-	{ 0, 2, -6, 6, -2 },	// BANDPASS_1_HIGHPASS_2,	// BP(1) * HP(2)
-	{ 0, 0, 4, -8, 4 },		// BANDPASS_2,				// BP(2) = BP(1) * BP(1)
-	{ 1, -2, 2, 0, 0 },		// NOTCH_1,					// N(1) = HP(2) + LP(2)
-	{ 0, 1, -2, 2, 0 },		// NOTCH_1_LOWPASS_1,		// N(1) * LP(1)
-	{ 0, 0, 1, -2, 2 },		// NOTCH_1_LOWPASS_2,		// N(1) * LP(2)
-	{ 1, -3, 4, -2, 0 },	// NOTCH_1_HIGHPASS_1,		// N(1) * HP(1)
-	{ 1, -4, 7, -6, 2 },	// NOTCH_1_HIGHPASS_2,		// N(1) * HP(2)
-	{ 1, -4, 8, -8, 4 },	// NOTCH_2,					// N(2) = N(1) * N(1)
-	{ 1, -2, 0, 0, 0 },		// PHASESHIFT_1,			// PS(1) = HP(1) - LP(1)
-	{ 1, -4, 4, 0, 0 },		// PHASESHIFT_2,			// PS(2) = PS(1) * PS(1)
-	{ 1, -6, 12, -8, 0 },	// PHASESHIFT_3,			// PS(3) = PS(2) * PS(1)
-	{ 1, -8, 24, -32, 16 },	// PHASESHIFT_4,			// PS(4) = PS(3) * PS(1)
-};
-
-// filter state
-FilterState flt_state[VOICES];
-
-// reset filter state
-void FilterState::Reset()
-{
-	feedback = 0.0f;
-#if FILTER == FILTER_IMPROVED_MOOG
-	a1 = 0.0f; b0 = 0.0f; b1 = 0.0f;
-#elif FILTER == FILTER_LINEAR_MOOG
-	previous = 0.0f;
-	delayed = 0.0f;
-	tune = 0.0f;
-#elif FILTER == FILTER_NONLINEAR_MOOG
-	previous = 0.0f;
-	delayed = 0.0f;
-	tune = 0.0f;
-	memset(z, 0, sizeof(z));
-#elif FILTER == FILTER_TPT_MOOG
-	inv1g = 0; G = 0; alpha0 = 0;
-	memset(z, 0, sizeof(z));
-#endif
-	memset(y, 0, sizeof(y));
-}
-
-// set filter mode
-void FilterConfig::SetMode(FilterConfig::Mode newmode)
-{
-	mode = newmode;
-	memcpy(mix, filter_mix[mode], sizeof(mix));
-}
-
-// compute filter values based on cutoff frequency and resonance
-void FilterState::Setup(float const cutoff, float const resonance, float const step)
-{
-	//float const fn = FILTER_OVERSAMPLE * 0.5f * info.freq;
-	//float const fc = cutoff < fn ? cutoff / fn : 1.0f;
-	float const fc = cutoff * step * 2.0f / FILTER_OVERSAMPLE;
-
-#if FILTER == FILTER_IMPROVED_MOOG
-
-	// Based on Improved Moog Filter description
-	// http://www.music.mcgill.ca/~ich/research/misc/papers/cr1071.pdf
-
-	float const g = 1 - expf(-M_PI * fc);
-	feedback = 4.0f * resonance;
-	// y[n] = ((1.0 / 1.3) * x[n] + (0.3 / 1.3) * x[n-1] - y[n-1]) * g + y[n-1]
-	// y[n] = (g / 1.3) * x[n] + (g * 0.3 / 1.3) * x[n-1] - (g - 1) * y[n-1]
-	a1 = 1.0f - g; b0 = g * 0.769231f; b1 = b0 * 0.3f;
-
-#elif FILTER == FILTER_LINEAR_MOOG
-
-	// Linear version of Antti Huovilainen's digital implementation
-	// http://www.acoustics.ed.ac.uk/wp-content/uploads/AMT_MSc_FinalProjects/2012__Daly__AMT_MSc_FinalProject_MoogVCF.pdf
-
-	// this part is more expensive than the Improved Moog but the filter itself is cheaper
-	float const fcr = ((1.8730f * fc + 0.4955f) * fc + -0.6490f) * fc + 0.9988f;
-	float const acr = (-3.9364f * fc + 1.8409f) * fc + 0.9968f;
-	feedback = resonance * 4.0f * acr;
-	tune = 1.0f - expf(-M_PI * fc * fcr);
-
-#elif FILTER == FILTER_NONLINEAR_MOOG
-
-	// Based on Antti Huovilainen's non-linear digital implementation
-	// http://dafx04.na.infn.it/WebProc/Proc/P_061.pdf
-	// https://raw.github.com/ddiakopoulos/MoogLadders/master/Source/Huovilainen.cpp
-	// 0 <= resonance <= 1
-
-	float const fcr = ((1.8730f * fc + 0.4955f) * fc + -0.6490f) * fc + 0.9988f;
-	float const acr = (-3.9364f * fc + 1.8409f) * fc + 0.9968f;
-	feedback = resonance * 4.0f * acr;
-	tune = (1.0f - expf(-M_PI * fc * fcr)) * 1.22070313f;
-
-#elif FILTER == FILTER_TPT_MOOG
-
-	// Based on Will Pirkle's implementation of Vadim Zavalishin's
-	// Topology-Preserving Transform (TPT) virtual analog ladder filter
-	// http://www.native-instruments.com/fileadmin/ni_media/downloads/pdf/VAFilterDesign_1.0.3.pdf
-	// http://www.willpirkle.com/Downloads/AN-4VirtualAnalogFilters.2.0.pdf
-
-	feedback = resonance * 4.0f;
-	if (fc < 0.5f)
-	{
-		float const f = 0.5f * M_PI * fc;
-		//float const g = tanf(f);
-		// polynomial approximation of tangent
-		// http://www.musicdsp.org/showone.php?id=115
-		// accurate for fc in the range [0.0,0.5]
-		float const ff = f * f;
-		//float const g = f * (1 + ff * (0.3333314036f + ff * (0.1333923995f + ff * (0.0533740603f + ff * (0.0245650893f + ff * (0.002900525f + ff * 0.0095168091f))))));
-		float const g = f * (1 + ff * (0.31755f + ff * 0.2033f));
-		inv1g = 1 / (1 + g);
-	}
-	else if (fc < 1.0f)
-	{
-		// use the identity 1 / tan(0.5 pi (1 - fc)) = tan(0.5 pi fc)
-        // accurate for fc in the range [0.5,1.0]
-		float const f = 0.5f * M_PI * (1 - fc);
-		float const ff = f * f;
-		float const invg = f * (1 + ff * (0.31755f + ff * 0.2033f));
-		// 1/(1+1/g) = g/(g+1) = 1-(1/(g+1))
-		inv1g = 1 - 1 / (1 + invg);
-	}
-	else
-	{
-		// 1/(1+infinity) = 0
-		inv1g = 0;
-	}
-	// g/(1+g) = 1-(1/(1+g))
-	G = 1 - inv1g;
-	alpha0 = 1 / (1 + feedback * G * G * G * G);
-#endif
-}
-
-// update the filter
-float FilterState::Update(FilterConfig const &config, float const input)
-{
-	// input with drive and gain compensation
-	float const input_adjusted = config.drive * (input + input * feedback * GAIN_COMPENSATION);
-
-#if FILTER == FILTER_IMPROVED_MOOG
-
-#if FILTER_OVERSAMPLE > 1
-	for (int i = 0; i < FILTER_OVERSAMPLE; ++i)
-#endif
-	{
-		// nonlinear feedback with gain compensation
-#if SATURATE == SATURATE_INPUT
-		float const in = Saturate(input_adjusted - feedback * y[4]);
-#else
-		float const in = input_adjusted - feedback * Saturate(y[4]);
-#endif
-
-		// stage 1: x1[n-1] = x1[n]; x1[n] = in;    y1[n-1] = y1[n]; y1[n] = func(y1[n-1], x1[n], x1[n-1])
-		// stage 2: x2[n-1] = x2[n]; x2[n] = y1[n]; y2[n-1] = y2[n]; y2[n] = func(y2[n-1], x2[n], x2[n-1])
-		// stage 3: x3[n-1] = x3[n]; x3[n] = y2[n]; y3[n-1] = y3[n]; y3[n] = func(y3[n-1], x3[n], x3[n-1])
-		// stage 4: x4[n-1] = x4[n]; x4[n] = y3[n]; y4[n-1] = y4[n]; y4[n] = func(y4[n-1], x4[n], x4[n-1])
-
-		// stage 1: x1[n-1] = x1[n]; x1[n] = in;    t1 = y1[n-1]; y1[n-1] = y1[n]; y1[n] = func(y1[n-1], x1[n], x1[n-1])
-		// stage 2: x2[n-1] = t1;    x2[n] = y1[n]; t2 = y2[n-1]; y2[n-1] = y2[n]; y2[n] = func(y2[n-1], x2[n], x2[n-1])
-		// stage 3: x3[n-1] = t2;    x3[n] = y2[n]; t3 = y3[n-1]; y3[n-1] = y3[n]; y3[n] = func(y3[n-1], x3[n], x3[n-1])
-		// stage 4: x4[n-1] = t3;    x4[n] = y3[n];               y4[n-1] = y4[n]; y4[n] = func(y4[n-1], x4[n], x4[n-1])
-
-		// t0 = y0[n], t1 = y1[n], t2 = y2[n], t3 = y3[n]
-		// stage 0: y0[n] = in
-		// stage 1: y1[n] = func(y1[n], y1[n], t0)
-		// stage 2: y2[n] = func(y2[n], y1[n], t1)
-		// stage 3: y3[n] = func(y3[n], y2[n], t2)
-		// stage 4: y4[n] = func(y4[n], y3[n], t3)
-
-		// four-pole low-pass filter
-		float const t[4] = { y[0], y[1], y[2], y[3] };
-		y[0] = in;
-		y[1] = y[1] * a1 + y[0] * b0 + t[0] * b1;
-		y[2] = y[2] * a1 + y[1] * b0 + t[1] * b1;
-		y[3] = y[3] * a1 + y[2] * b0 + t[2] * b1;
-		y[4] = y[4] * a1 + y[3] * b0 + t[3] * b1;
-	}
-
-#elif FILTER == FILTER_LINEAR_MOOG
-
-#if FILTER_OVERSAMPLE > 1
-	for (int i = 0; i < FILTER_OVERSAMPLE; ++i)
-#endif
-	{
-		// half-sample delay for phase compensation
-		delayed = 0.5f * (y[4] + previous);
-		previous = y[4];
-
-		// nonlinear feedback with gain compensation
-#if SATURATE == SATURATE_INPUT
-		y[0] = Saturate(input_adjusted - feedback * delayed);
-#else
-		y[0] = input_adjusted - feedback * Saturate(delayed);
-#endif
-
-		// four-pole low-pass filter
-		y[1] += tune * (y[0] - y[1]);
-		y[2] += tune * (y[1] - y[2]);
-		y[3] += tune * (y[2] - y[3]);
-		y[4] += tune * (y[3] - y[4]);
-	}
-
-#elif FILTER == FILTER_NONLINEAR_MOOG
-
-	// modified original algorithm based on sample code here:
-	// http://www.kvraudio.com/forum/viewtopic.php?p=3821632
-#if FILTER_OVERSAMPLE > 1
-	for (int i = 0; i < FILTER_OVERSAMPLE; ++i)
-#endif
-	{
-		// half-sample delay for phase compensation
-		delayed = 0.5f * (y[4] + previous);
-		previous = y[4];
-
-		// nonlinear feedback with gain compensation
-		y[0] = input_adjusted - feedback * delayed;
-		z[0] = FastTanh(y[0] * 0.8192f);
-
-		// nonlinear four-pole low-pass filter
-		y[1] += tune * (z[0] - z[1]);
-		z[1] = FastTanh(y[1] * 0.8192f);
-		y[2] += tune * (z[1] - z[2]);
-		z[2] = FastTanh(y[2] * 0.8192f);
-		y[3] += tune * (z[2] - z[3]);
-		z[3] = FastTanh(y[3] * 0.8192f);
-		y[4] += tune * (z[3] - z[4]);
-		z[4] = FastTanh(y[4] * 0.8192f);
-	}
-
-#elif FILTER == FILTER_TPT_MOOG
-
-	// nonlinear feedback with gain compensation
-	float const S = (((z[0] * G + z[1]) * G + z[2]) * G + z[3]) * inv1g;
-#if SATURATE == SATURATE_INPUT
-	y[0] = Saturate(alpha0 * (input_adjusted - feedback * S));
-#else
-	y[0] = alpha0 * (input_adjusted - feedback * Saturate(S));
-#endif
-
-	// four-pole low-pass filter
-	register float v;
-	v = (y[0] - z[0]) * G;
-	y[1] = v + z[0];
-	z[0] = y[1] + v;
-	v = (y[1] - z[1]) * G;
-	y[2] = v + z[1];
-	z[1] = y[2] + v;
-	v = (y[2] - z[2]) * G;
-	y[3] = v + z[2];
-	z[2] = y[3] + v;
-	v = (y[3] - z[3]) * G;
-	y[4] = v + z[3];
-	z[3] = y[4] + v;
-
-#endif
-
-	// generate output by mixing stage values
-	return
-		y[0] * config.mix[0] +
-		y[1] * config.mix[1] +
-		y[2] * config.mix[2] +
-		y[3] * config.mix[3] +
-		y[4] * config.mix[4];
-}
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Filter
+*/
+#include "Platform.h"
+
+#include "Filter.h"
+#include "Envelope.h"
+#include "Math.h"
+#include "Voice.h"
+
+// cubic saturation function
+float CubicSaturate(float const x)
+{
+	if (x >= 1.5f)
+		return 1;
+	if (x <= -1.5f)
+		return -1;
+	return x - 0.14814814814814814814814814814815f * x * x * x;
+}
+
+// filter saturation type
+#define SATURATE_FEEDBACK 0	// saturate feedback path
+#define SATURATE_INPUT 1	// saturate input after feedback
+// saturating input makes the filter work more like a hardware analog filter,
+// adding harmonics to higher-amplitude input signals for an "overdrive" effect
+#define SATURATE SATURATE_INPUT
+
+// saturation function to apply
+// (arranged from cheapest to costliest)
+//#define Saturate(x) (x)
+//#define Saturate(x) Clamp(x, -1.0f, 1.0f)
+//#define Saturate(x) CubicSaturate(x)
+#define Saturate(x) FastTanh(x)
+//#define Saturate(x) tanhf(x)
+
+// compensate for reduced gain at low frequencies as resonance increases
+// 0.0: no compensation, -12dB at low frequencies
+// 0.5: half compensation, -6dB at low frequencies
+// 1.0: full compensation, -0dB at low frequencies
+static float const GAIN_COMPENSATION = 0.5f;
+
+// filter configuration
+FilterConfig flt_config(false, FilterConfig::LOWPASS_4, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f);
+
+// filter envelope config
+EnvelopeConfig flt_env_config(false, 0.0f, 1.0f, 0.0f, 0.1f);
+
+// filter envelope state
+EnvelopeState flt_env_state[VOICES_MAX];
+
+// filter mode names
+char const * const filter_name[FilterConfig::COUNT] =
+{
+	"Peak",
+	"Low-Pass 1",
+	"Low-Pass 2",
+	"Low-Pass 3",
+	"Low-Pass 4",
+	"High-Pass 1",
+	"High-Pass 2",
+	"High-Pass 3",
+	"High-Pass 4",
+	"Band-Pass 1",
+	"Band 1 + Low 1",
+	"Band 1 + Low 2",
+	"Band 1 + High 1",
+	"Band 1 + High 2",
+	"Band-Pass 2",
+	"Notch 1",
+	"Notch 1 + Low 1",
+	"Notch 1 + Low 2",
+	"Notch 1 + High 1",
+	"Notch 1 + High 2",
+	"Notch 2",
+	"Phase Shift 1",
+	"Phase Shift 2",
+	"Phase Shift 3",
+	"Phase Shift 4",
+};
+
+// filter model names
+char const * const filter_model_name[FILTER_MODEL_COUNT] =
+{
+	"Improved Moog",
+	"Linear Moog",
+	"Nonlinear Moog",
+	"TPT Moog",
+};
+
+// oversampling factor for each filter model
+static int const filter_oversample[FILTER_MODEL_COUNT] = { 2, 2, 2, 1 };
+
+// The Oberheim Xpander and Matrix-12 analog synthesizers use a typical four-
+// stage low-pass filter but combine voltages from each stage to produce 15
+// different filter modes.  The publication describing the Improved Moog Filter
+// mentioned this but gave no details.
+
+// The circuit diagram on page 4 of the Oberheim Matrix-12 Service Manual
+// shows how the filter works:
+// http://elektrotanya.com/oberheim_matrix-12_sm.pdf/download.html
+
+// The first three bits of the filter mode select one of eight resistor
+// networks that combine the stage voltages in various ways.  The fourth
+// bit disables the first filter stage.
+
+// The mixing values below were derived from the resistor networks in the
+// circuit diagram.  The IIR digital filter has an additional stage output
+// to work with and no hard restriction on the number of options so there
+// are several more filter options here than on the Oberheim synthesizers.
+
+// Also: http://www.kvraudio.com/forum/viewtopic.php?p=3821632
+
+// Creating Filters
+
+// Use stage output directly for a 1-pole low-pass filter:
+// LP(1) = y[1]
+
+// Subtract stage output from stage input for a 1-pole high-pass filter"
+// HP(1) = y[0] - y[1]
+
+// Add coefficient vectors (+) to apply filters in parallel:
+// Filter A: a0, a1, a2, a3, a4
+// Filter B: b0, b1, b2, b3, b4
+// Filter A + B: a0 + b0, a1 + b2, a2 + b2, a3 + b3, a4 + b4
+
+// Scale coefficient vector (*) to scale filter output:
+// Filter A: a0, a1, a2, a3, a4
+// Scale: s
+// Filter A * s: a0 * s, a1 * s, a2 * s, a3 * s, a4 * s
+
+// Convolve coefficient vectors (*) to apply filters in series:
+// Filter A: a0, a1, a2, a3, a4
+// Filter B: b0, b1, b2, b3, b4
+// Filter A * B:
+//		a0 * b0,
+//		a0 * b1 + a1 * b0,
+//		a0 * b2 + a1 * b1 + a2 * b0,
+//		a0 * b3 + a1 * b2 + a2 * b1 + a3 * b0,
+//		a0 * b4 + a1 * b3 + a2 * b2 + a3 * b1 + a4 * b0
+
+// Band-pass is a low-pass and high-pass in series:
+// BP(1) = HP(1) * LP(1) or LP(1) * HP(1) = y[1] - 2 y[2]
+
+// 1-Pole Low-Pass phase shift: -atan(frequency/cutoff)
+// 0 degrees at low frequencies
+// -45 degrees at the cutoff frequency
+// -90 degrees at high frequencies
+
+// 1-Pole High-Pass phase shift: pi/2 - atan(frequency/cutoff)
+// +90 degrees at low frequencies
+// +45 degrees at the cutoff frequency
+// 0 degrees at high frequencies
+
+// Filters in series combine phase shifts
+// 4P Band-Pass = 2P Low-Pass * 2P High-Pass = pi - 4 atan(frequency/cutoff))
+
+// Filters in parallel add signals
+// 2P Notch = 2P Low-Pass + 2P High-Pass
+// 2P Phase-Shift = 2P Low-Pass - 2P High-Pass
+// 2P Low-Pass phase shift: -2 atan(frequency/cutoff)
+// 2P High-Pass phase shift: pi - 2 atan(frequency/cutoff)
+// Signals are 180 degrees out of phase so they have opposite signs
+// 2P Notch adds the signals so they cancel each other
+// 2P Phase-Shift subtracts the signals so they reinforce each other
+
+// filter stage coefficients for each filter mode
+static float const filter_mix[FilterConfig::COUNT][5] =
+{
+	//y0 y1 y2 y3 y4 
+	{ 1, 0, 0, 0, 0 },		// PEAK,					// input with feedback term
+	{ 0, 1, 0, 0, 0 },		// LOWPASS_1,				// LP(1) = y[1]
+	{ 0, 0, 1, 0, 0 },		// LOWPASS_2,				// LP(2) = LP(1) * LP(1) = y[2]
+	{ 0, 0, 0, 1, 0 },		// LOWPASS_3,				// LP(3) = LP(2) * LP(1) = y[3]
+	{ 0, 0, 0, 0, 1 },		// LOWPASS_4,				// LP(4) = LP(3) * LP(1) = y[4]
+	{ 1, -1, 0, 0, 0 },		// HIGHPASS_1,				// HP(1) = y[0] - y[1]
+	{ 1, -2, 1, 0, 0 },		// HIGHPASS_2,				// HP(2) = HP(1) * HP(1)
+	{ 1, -3, 3, -1, 0 },	// HIGHPASS_3,				// HP(3) = HP(2) * HP(1)
+	{ 1, -4, 6, -4, 1 },	// HIGHPASS_4,				// HP(4) = HP(3) * HP(1)
+	{ 0, 2, -2, 0, 0 },		// BANDPASS_1,				// BP(1) = LP(1) * HP(1) * 2
+	{ 0, 0, 2, -2, 0 },		// BANDPASS_1_LOWPASS_1,	// BP(1) * LP(1)
+	{ 0, 0, 0, 2, -2 },		// BANDPASS_1_LOWPASS_2,	// BP(1) * LP(2)
+	{ 0, 2, -4, 2, 0 },		// BANDPASS_1_HIGHPASS_1,	// BP(1) * HP(1)
+	{ 0, 2, -6, 6, -2 },	// BANDPASS_1_HIGHPASS_2,	// BP(1) * HP(2)
+	{ 0, 0, 4, -8, 4 },		// BANDPASS_2,				// BP(2) = BP(1) * BP(1)
+	{ 1, -2, 2, 0, 0 },		// NOTCH_1,					// N(1) = HP(2) + LP(2)
+	{ 0, 1, -2, 2, 0 },		// NOTCH_1_LOWPASS_1,		// N(1) * LP(1)
+	{ 0, 0, 1, -2, 2 },		// NOTCH_1_LOWPASS_2,		// N(1) * LP(2)
+	{ 1, -3, 4, -2, 0 },	// NOTCH_1_HIGHPASS_1,		// N(1) * HP(1)
+	{ 1, -4, 7, -6, 2 },	// NOTCH_1_HIGHPASS_2,		// N(1) * HP(2)
+	{ 1, -4, 8, -8, 4 },	// NOTCH_2,					// N(2) = N(1) * N(1)
+	{ 1, -2, 0, 0, 0 },		// PHASESHIFT_1,			// PS(1) = HP(1) - LP(1)
+	{ 1, -4, 4, 0, 0 },		// PHASESHIFT_2,			// PS(2) = PS(1) * PS(1)
+	{ 1, -6, 12, -8, 0 },	// PHASESHIFT_3,			// PS(3) = PS(2) * PS(1)
+	{ 1, -8, 24, -32, 16 },	// PHASESHIFT_4,			// PS(4) = PS(3) * PS(1)
+};
+
+// filter banks
+FilterBank flt_bank[(VOICES_MAX + FILTER_LANES - 1) / FILTER_LANES];
+
+// reset filter state
+void FilterState::Reset()
+{
+	feedback = 0.0f;
+	a1 = 0.0f; b0 = 0.0f; b1 = 0.0f;
+	previous = 0.0f;
+	delayed = 0.0f;
+	tune = 0.0f;
+	inv1g = 0; G = 0; alpha0 = 0;
+	memset(z, 0, sizeof(z));
+	memset(y, 0, sizeof(y));
+}
+
+// set filter mode
+void FilterConfig::SetMode(FilterConfig::Mode newmode)
+{
+	mode = newmode;
+	memcpy(mix, filter_mix[mode], sizeof(mix));
+}
+
+// coefficient table intervals
+// (entries are spaced evenly in normalized cutoff from 0 to 1, the
+// oversampled Nyquist frequency, with the last entry repeated so lookups
+// at the top of the range can interpolate)
+#define FILTER_TABLE_SIZE 2048
+
+// coefficient table entry
+// (the terms of each model's coefficients that depend on cutoff)
+struct FilterTableEntry
+{
+	// improved moog stage gain, huovilainen tuning coefficient,
+	// or tpt integrator gain
+	float coefficient;
+
+	// feedback coefficient at 100% resonance
+	float feedback;
+};
+
+// coefficient tables for each filter model
+static FilterTableEntry filter_table[FILTER_MODEL_COUNT][FILTER_TABLE_SIZE + 2];
+
+// table position per unit of cutoff frequency times sample step
+// (accounts for each model's oversampling)
+static float filter_table_scale[FILTER_MODEL_COUNT];
+
+// improved moog filter coefficients
+static inline void ComputeImprovedMoog(float const fc, FilterTableEntry &entry)
+{
+	// Based on Improved Moog Filter description
+	// http://www.music.mcgill.ca/~ich/research/misc/papers/cr1071.pdf
+
+	entry.coefficient = 1 - expf(-M_PI * fc);
+	entry.feedback = 4.0f;
+}
+
+// linear huovilainen filter coefficients
+static inline void ComputeLinearMoog(float const fc, FilterTableEntry &entry)
+{
+	// Linear version of Antti Huovilainen's digital implementation
+	// http://www.acoustics.ed.ac.uk/wp-content/uploads/AMT_MSc_FinalProjects/2012__Daly__AMT_MSc_FinalProject_MoogVCF.pdf
+
+	float const fcr = ((1.8730f * fc + 0.4955f) * fc + -0.6490f) * fc + 0.9988f;
+	float const acr = (-3.9364f * fc + 1.8409f) * fc + 0.9968f;
+	entry.coefficient = 1.0f - expf(-M_PI * fc * fcr);
+	entry.feedback = 4.0f * acr;
+}
+
+// nonlinear huovilainen filter coefficients
+static inline void ComputeNonlinearMoog(float const fc, FilterTableEntry &entry)
+{
+	// Based on Antti Huovilainen's non-linear digital implementation
+	// http://dafx04.na.infn.it/WebProc/Proc/P_061.pdf
+	// https://raw.github.com/ddiakopoulos/MoogLadders/master/Source/Huovilainen.cpp
+	// 0 <= resonance <= 1
+
+	float const fcr = ((1.8730f * fc + 0.4955f) * fc + -0.6490f) * fc + 0.9988f;
+	float const acr = (-3.9364f * fc + 1.8409f) * fc + 0.9968f;
+	entry.coefficient = (1.0f - expf(-M_PI * fc * fcr)) * 1.22070313f;
+	entry.feedback = 4.0f * acr;
+}
+
+// topology-preserving transform filter coefficients
+static inline void ComputeTPTMoog(float const fc, FilterTableEntry &entry)
+{
+	// Based on Will Pirkle's implementation of Vadim Zavalishin's
+	// Topology-Preserving Transform (TPT) virtual analog ladder filter
+	// http://www.native-instruments.com/fileadmin/ni_media/downloads/pdf/VAFilterDesign_1.0.3.pdf
+	// http://www.willpirkle.com/Downloads/AN-4VirtualAnalogFilters.2.0.pdf
+
+	float inv1g;
+	if (fc < 0.5f)
+	{
+		float const f = 0.5f * M_PI * fc;
+		//float const g = tanf(f);
+		// polynomial approximation of tangent
+		// http://www.musicdsp.org/showone.php?id=115
+		// accurate for fc in the range [0.0,0.5]
+		float const ff = f * f;
+		//float const g = f * (1 + ff * (0.3333314036f + ff * (0.1333923995f + ff * (0.0533740603f + ff * (0.0245650893f + ff * (0.002900525f + ff * 0.0095168091f))))));
+		float const g = f * (1 + ff * (0.31755f + ff * 0.2033f));
+		inv1g = 1 / (1 + g);
+	}
+	else if (fc < 1.0f)
+	{
+		// use the identity 1 / tan(0.5 pi (1 - fc)) = tan(0.5 pi fc)
+		// accurate for fc in the range [0.5,1.0]
+		float const f = 0.5f * M_PI * (1 - fc);
+		float const ff = f * f;
+		float const invg = f * (1 + ff * (0.31755f + ff * 0.2033f));
+		// 1/(1+1/g) = g/(g+1) = 1-(1/(g+1))
+		inv1g = 1 - 1 / (1 + invg);
+	}
+	else
+	{
+		// 1/(1+infinity) = 0
+		inv1g = 0;
+	}
+	// g/(1+g) = 1-(1/(1+g))
+	entry.coefficient = 1 - inv1g;
+	entry.feedback = 4.0f;
+}
+
+// build the filter coefficient tables
+// (normalized cutoff does not depend on the sample rate,
+// so the tables only need to be built once)
+void InitFilter()
+{
+	for (int model = 0; model < FILTER_MODEL_COUNT; ++model)
+		filter_table_scale[model] = 2.0f * FILTER_TABLE_SIZE / filter_oversample[model];
+
+	for (int i = 0; i <= FILTER_TABLE_SIZE + 1; ++i)
+	{
+		float const fc = float(Min(i, FILTER_TABLE_SIZE)) / FILTER_TABLE_SIZE;
+		ComputeImprovedMoog(fc, filter_table[FILTER_IMPROVED_MOOG][i]);
+		ComputeLinearMoog(fc, filter_table[FILTER_LINEAR_MOOG][i]);
+		ComputeNonlinearMoog(fc, filter_table[FILTER_NONLINEAR_MOOG][i]);
+		ComputeTPTMoog(fc, filter_table[FILTER_TPT_MOOG][i]);
+	}
+}
+
+// interpolate coefficient table values for a cutoff frequency
+// (cutoffs above the oversampled Nyquist frequency use the values there)
+static inline FilterTableEntry LookupFilterTable(int const model, float const cutoff, float const step)
+{
+	float const x = Min(cutoff * step * filter_table_scale[model], float(FILTER_TABLE_SIZE));
+	int const i = FloorInt(x);
+	float const s = x - i;
+	FilterTableEntry const &e0 = filter_table[model][i];
+	FilterTableEntry const &e1 = filter_table[model][i + 1];
+	FilterTableEntry entry;
+	entry.coefficient = Lerp(e0.coefficient, e1.coefficient, s);
+	entry.feedback = Lerp(e0.feedback, e1.feedback, s);
+	return entry;
+}
+
+// improved moog filter coefficients from table values
+static inline void SetupImprovedMoog(FilterTableEntry const &entry, float const resonance, float &feedback, float &a1, float &b0, float &b1)
+{
+	float const g = entry.coefficient;
+	feedback = resonance * entry.feedback;
+	// y[n] = ((1.0 / 1.3) * x[n] + (0.3 / 1.3) * x[n-1] - y[n-1]) * g + y[n-1]
+	// y[n] = (g / 1.3) * x[n] + (g * 0.3 / 1.3) * x[n-1] - (g - 1) * y[n-1]
+	a1 = 1.0f - g; b0 = g * 0.769231f; b1 = b0 * 0.3f;
+}
+
+// huovilainen filter coefficients from table values
+// (the linear and nonlinear versions differ only in their tables)
+static inline void SetupHuovilainenMoog(FilterTableEntry const &entry, float const resonance, float &feedback, float &tune)
+{
+	feedback = resonance * entry.feedback;
+	tune = entry.coefficient;
+}
+
+// topology-preserving transform filter coefficients from table values
+static inline void SetupTPTMoog(FilterTableEntry const &entry, float const resonance, float &feedback, float &inv1g, float &G, float &alpha0)
+{
+	feedback = resonance * entry.feedback;
+	G = entry.coefficient;
+	inv1g = 1 - G;
+	alpha0 = 1 / (1 + feedback * Squared(Squared(G)));
+}
+
+// compute filter values based on cutoff frequency and resonance
+void FilterState::Setup(int const model, float const cutoff, float const resonance, float const step)
+{
+	FilterTableEntry const entry = LookupFilterTable(model, cutoff, step);
+
+	switch (model)
+	{
+	case FILTER_IMPROVED_MOOG:
+		SetupImprovedMoog(entry, resonance, feedback, a1, b0, b1);
+		break;
+	case FILTER_LINEAR_MOOG:
+	case FILTER_NONLINEAR_MOOG:
+		SetupHuovilainenMoog(entry, resonance, feedback, tune);
+		break;
+	case FILTER_TPT_MOOG:
+		SetupTPTMoog(entry, resonance, feedback, inv1g, G, alpha0);
+		break;
+	}
+}
+
+// update the filter
+float FilterState::Update(FilterConfig const &config, float const input)
+{
+	// input with drive and gain compensation
+	float const input_adjusted = config.drive * (input + input * feedback * GAIN_COMPENSATION);
+
+	switch (config.model)
+	{
+	case FILTER_IMPROVED_MOOG:
+		for (int i = 0; i < 2; ++i)
+		{
+			// nonlinear feedback with gain compensation
+#if SATURATE == SATURATE_INPUT
+			float const in = Saturate(input_adjusted - feedback * y[4]);
+#else
+			float const in = input_adjusted - feedback * Saturate(y[4]);
+#endif
+
+			// stage 1: x1[n-1] = x1[n]; x1[n] = in;    y1[n-1] = y1[n]; y1[n] = func(y1[n-1], x1[n], x1[n-1])
+			// stage 2: x2[n-1] = x2[n]; x2[n] = y1[n]; y2[n-1] = y2[n]; y2[n] = func(y2[n-1], x2[n], x2[n-1])
+			// stage 3: x3[n-1] = x3[n]; x3[n] = y2[n]; y3[n-1] = y3[n]; y3[n] = func(y3[n-1], x3[n], x3[n-1])
+			// stage 4: x4[n-1] = x4[n]; x4[n] = y3[n]; y4[n-1] = y4[n]; y4[n] = func(y4[n-1], x4[n], x4[n-1])
+
+			// stage 1: x1[n-1] = x1[n]; x1[n] = in;    t1 = y1[n-1]; y1[n-1] = y1[n]; y1[n] = func(y1[n-1], x1[n], x1[n-1])
+			// stage 2: x2[n-1] = t1;    x2[n] = y1[n]; t2 = y2[n-1]; y2[n-1] = y2[n]; y2[n] = func(y2[n-1], x2[n], x2[n-1])
+			// stage 3: x3[n-1] = t2;    x3[n] = y2[n]; t3 = y3[n-1]; y3[n-1] = y3[n]; y3[n] = func(y3[n-1], x3[n], x3[n-1])
+			// stage 4: x4[n-1] = t3;    x4[n] = y3[n];               y4[n-1] = y4[n]; y4[n] = func(y4[n-1], x4[n], x4[n-1])
+
+			// t0 = y0[n], t1 = y1[n], t2 = y2[n], t3 = y3[n]
+			// stage 0: y0[n] = in
+			// stage 1: y1[n] = func(y1[n], y1[n], t0)
+			// stage 2: y2[n] = func(y2[n], y1[n], t1)
+			// stage 3: y3[n] = func(y3[n], y2[n], t2)
+			// stage 4: y4[n] = func(y4[n], y3[n], t3)
+
+			// four-pole low-pass filter
+			float const t[4] = { y[0], y[1], y[2], y[3] };
+			y[0] = in;
+			y[1] = y[1] * a1 + y[0] * b0 + t[0] * b1;
+			y[2] = y[2] * a1 + y[1] * b0 + t[1] * b1;
+			y[3] = y[3] * a1 + y[2] * b0 + t[2] * b1;
+			y[4] = y[4] * a1 + y[3] * b0 + t[3] * b1;
+		}
+		break;
+
+	case FILTER_LINEAR_MOOG:
+		for (int i = 0; i < 2; ++i)
+		{
+			// half-sample delay for phase compensation
+			delayed = 0.5f * (y[4] + previous);
+			previous = y[4];
+
+			// nonlinear feedback with gain compensation
+#if SATURATE == SATURATE_INPUT
+			y[0] = Saturate(input_adjusted - feedback * delayed);
+#else
+			y[0] = input_adjusted - feedback * Saturate(delayed);
+#endif
+
+			// four-pole low-pass filter
+			y[1] += tune * (y[0] - y[1]);
+			y[2] += tune * (y[1] - y[2]);
+			y[3] += tune * (y[2] - y[3]);
+			y[4] += tune * (y[3] - y[4]);
+		}
+		break;
+
+	case FILTER_NONLINEAR_MOOG:
+		// modified original algorithm based on sample code here:
+		// http://www.kvraudio.com/forum/viewtopic.php?p=3821632
+		for (int i = 0; i < 2; ++i)
+		{
+			// half-sample delay for phase compensation
+			delayed = 0.5f * (y[4] + previous);
+			previous = y[4];
+
+			// nonlinear feedback with gain compensation
+			y[0] = input_adjusted - feedback * delayed;
+			z[0] = FastTanh(y[0] * 0.8192f);
+
+			// nonlinear four-pole low-pass filter
+			y[1] += tune * (z[0] - z[1]);
+			z[1] = FastTanh(y[1] * 0.8192f);
+			y[2] += tune * (z[1] - z[2]);
+			z[2] = FastTanh(y[2] * 0.8192f);
+			y[3] += tune * (z[2] - z[3]);
+			z[3] = FastTanh(y[3] * 0.8192f);
+			y[4] += tune * (z[3] - z[4]);
+			z[4] = FastTanh(y[4] * 0.8192f);
+		}
+		break;
+
+	case FILTER_TPT_MOOG:
+		{
+			// nonlinear feedback with gain compensation
+			float const S = (((z[0] * G + z[1]) * G + z[2]) * G + z[3]) * inv1g;
+#if SATURATE == SATURATE_INPUT
+			y[0] = Saturate(alpha0 * (input_adjusted - feedback * S));
+#else
+			y[0] = alpha0 * (input_adjusted - feedback * Saturate(S));
+#endif
+
+			// four-pole low-pass filter
+			float v;
+			v = (y[0] - z[0]) * G;
+			y[1] = v + z[0];
+			z[0] = y[1] + v;
+			v = (y[1] - z[1]) * G;
+			y[2] = v + z[1];
+			z[1] = y[2] + v;
+			v = (y[2] - z[2]) * G;
+			y[3] = v + z[2];
+			z[2] = y[3] + v;
+			v = (y[3] - z[3]) * G;
+			y[4] = v + z[3];
+			z[3] = y[4] + v;
+		}
+		break;
+	}
+
+	// generate output by mixing stage values
+	return
+		y[0] * config.mix[0] +
+		y[1] * config.mix[1] +
+		y[2] * config.mix[2] +
+		y[3] * config.mix[3] +
+		y[4] * config.mix[4];
+}
+
+// filter a block of samples in place
+void FilterState::Render(FilterConfig const &config, float buffer[], size_t count)
+{
+	for (size_t i = 0; i < count; ++i)
+		buffer[i] = Update(config, buffer[i]);
+}
+
+// reset filter state for one lane
+void FilterBank::Reset(int const lane)
+{
+	feedback[lane] = 0.0f;
+	a1[lane] = 0.0f; b0[lane] = 0.0f; b1[lane] = 0.0f;
+	previous[lane] = 0.0f;
+	delayed[lane] = 0.0f;
+	tune[lane] = 0.0f;
+	inv1g[lane] = 0.0f; G[lane] = 0.0f; alpha0[lane] = 0.0f;
+	for (int i = 0; i < 5; ++i)
+	{
+		z[i][lane] = 0.0f;
+		y[i][lane] = 0.0f;
+	}
+	feedback_step[lane] = 0.0f;
+	a1_step[lane] = 0.0f; b0_step[lane] = 0.0f; b1_step[lane] = 0.0f;
+	tune_step[lane] = 0.0f;
+	inv1g_step[lane] = 0.0f; G_step[lane] = 0.0f; alpha0_step[lane] = 0.0f;
+	primed[lane] = false;
+}
+
+// set up a linear ramp from a previous coefficient to the current one
+static inline void RampCoefficient(float value[], float value_step[], int const lane, float const from, float const scale)
+{
+	value_step[lane] = (value[lane] - from) * scale;
+	value[lane] = from;
+}
+
+// compute filter values for one lane based on cutoff frequency and resonance
+void FilterBank::Setup(int const lane, int const model, float const cutoff, float const resonance, float const step, size_t const ramp)
+{
+	FilterTableEntry const entry = LookupFilterTable(model, cutoff, step);
+
+	// previous coefficients
+	float const feedback0 = feedback[lane];
+	float const a10 = a1[lane], b00 = b0[lane], b10 = b1[lane];
+	float const tune0 = tune[lane];
+	float const inv1g0 = inv1g[lane], G0 = G[lane], alpha00 = alpha0[lane];
+
+	switch (model)
+	{
+	case FILTER_IMPROVED_MOOG:
+		SetupImprovedMoog(entry, resonance, feedback[lane], a1[lane], b0[lane], b1[lane]);
+		break;
+	case FILTER_LINEAR_MOOG:
+	case FILTER_NONLINEAR_MOOG:
+		SetupHuovilainenMoog(entry, resonance, feedback[lane], tune[lane]);
+		break;
+	case FILTER_TPT_MOOG:
+		SetupTPTMoog(entry, resonance, feedback[lane], inv1g[lane], G[lane], alpha0[lane]);
+		break;
+	}
+
+	// ramp from the previous coefficients unless the lane was just reset
+	if (ramp && primed[lane])
+	{
+		float const scale = 1.0f / ramp;
+		RampCoefficient(feedback, feedback_step, lane, feedback0, scale);
+		RampCoefficient(a1, a1_step, lane, a10, scale);
+		RampCoefficient(b0, b0_step, lane, b00, scale);
+		RampCoefficient(b1, b1_step, lane, b10, scale);
+		RampCoefficient(tune, tune_step, lane, tune0, scale);
+		RampCoefficient(inv1g, inv1g_step, lane, inv1g0, scale);
+		RampCoefficient(G, G_step, lane, G0, scale);
+		RampCoefficient(alpha0, alpha0_step, lane, alpha00, scale);
+	}
+	primed[lane] = true;
+}
+
+// gather one input sample from each lane
+static inline SIMDFloat GatherLanes(float * const buffer[FILTER_LANES], size_t const i)
+{
+	SIMD_ALIGN float value[FILTER_LANES];
+	for (int lane = 0; lane < FILTER_LANES; ++lane)
+		value[lane] = buffer[lane] ? buffer[lane][i] : 0.0f;
+	return SIMDFloat::Load(value);
+}
+
+// scatter one output sample to each lane
+static inline void ScatterLanes(float * const buffer[FILTER_LANES], size_t const i, SIMDFloat const output)
+{
+	SIMD_ALIGN float value[FILTER_LANES];
+	output.Store(value);
+	for (int lane = 0; lane < FILTER_LANES; ++lane)
+	{
+		if (buffer[lane])
+			buffer[lane][i] = value[lane];
+	}
+}
+
+// filter a block of samples in place for each lane
+// (mirrors FilterState::Update with the state held in vector registers;
+// coefficients step toward the values from Setup before each sample)
+void FilterBank::Render(FilterConfig const &config, float * const buffer[FILTER_LANES], size_t count)
+{
+	SIMDFloat const mix0(config.mix[0]), mix1(config.mix[1]), mix2(config.mix[2]), mix3(config.mix[3]), mix4(config.mix[4]);
+	SIMDFloat const drive(config.drive);
+	SIMDFloat fb = SIMDFloat::Load(feedback);
+	SIMDFloat const fb_step = SIMDFloat::Load(feedback_step);
+
+	SIMDFloat y0 = SIMDFloat::Load(y[0]), y1 = SIMDFloat::Load(y[1]), y2 = SIMDFloat::Load(y[2]), y3 = SIMDFloat::Load(y[3]), y4 = SIMDFloat::Load(y[4]);
+
+	switch (config.model)
+	{
+	case FILTER_IMPROVED_MOOG:
+		{
+			SIMDFloat a1v = SIMDFloat::Load(a1), b0v = SIMDFloat::Load(b0), b1v = SIMDFloat::Load(b1);
+			SIMDFloat const a1s = SIMDFloat::Load(a1_step), b0s = SIMDFloat::Load(b0_step), b1s = SIMDFloat::Load(b1_step);
+			for (size_t i = 0; i < count; ++i)
+			{
+				fb = fb + fb_step;
+				a1v = a1v + a1s; b0v = b0v + b0s; b1v = b1v + b1s;
+				SIMDFloat const input = GatherLanes(buffer, i);
+				SIMDFloat const input_adjusted = drive * (input + input * fb * SIMDFloat(GAIN_COMPENSATION));
+				for (int o = 0; o < 2; ++o)
+				{
+#if SATURATE == SATURATE_INPUT
+					SIMDFloat const in = Saturate(input_adjusted - fb * y4);
+#else
+					SIMDFloat const in = input_adjusted - fb * Saturate(y4);
+#endif
+					SIMDFloat const t0 = y0, t1 = y1, t2 = y2, t3 = y3;
+					y0 = in;
+					y1 = y1 * a1v + y0 * b0v + t0 * b1v;
+					y2 = y2 * a1v + y1 * b0v + t1 * b1v;
+					y3 = y3 * a1v + y2 * b0v + t2 * b1v;
+					y4 = y4 * a1v + y3 * b0v + t3 * b1v;
+				}
+				ScatterLanes(buffer, i, y0 * mix0 + y1 * mix1 + y2 * mix2 + y3 * mix3 + y4 * mix4);
+			}
+			a1v.Store(a1); b0v.Store(b0); b1v.Store(b1);
+		}
+		break;
+
+	case FILTER_LINEAR_MOOG:
+		{
+			SIMDFloat tunev = SIMDFloat::Load(tune);
+			SIMDFloat const tunes = SIMDFloat::Load(tune_step);
+			SIMDFloat prev = SIMDFloat::Load(previous), del = SIMDFloat::Load(delayed);
+			for (size_t i = 0; i < count; ++i)
+			{
+				fb = fb + fb_step;
+				tunev = tunev + tunes;
+				SIMDFloat const input = GatherLanes(buffer, i);
+				SIMDFloat const input_adjusted = drive * (input + input * fb * SIMDFloat(GAIN_COMPENSATION));
+				for (int o = 0; o < 2; ++o)
+				{
+					del = SIMDFloat(0.5f) * (y4 + prev);
+					prev = y4;
+#if SATURATE == SATURATE_INPUT
+					y0 = Saturate(input_adjusted - fb * del);
+#else
+					y0 = input_adjusted - fb * Saturate(del);
+#endif
+					y1 = y1 + tunev * (y0 - y1);
+					y2 = y2 + tunev * (y1 - y2);
+					y3 = y3 + tunev * (y2 - y3);
+					y4 = y4 + tunev * (y3 - y4);
+				}
+				ScatterLanes(buffer, i, y0 * mix0 + y1 * mix1 + y2 * mix2 + y3 * mix3 + y4 * mix4);
+			}
+			prev.Store(previous); del.Store(delayed);
+			tunev.Store(tune);
+		}
+		break;
+
+	case FILTER_NONLINEAR_MOOG:
+		{
+			SIMDFloat tunev = SIMDFloat::Load(tune);
+			SIMDFloat const tunes = SIMDFloat::Load(tune_step);
+			SIMDFloat const scale(0.8192f);
+			SIMDFloat prev = SIMDFloat::Load(previous), del = SIMDFloat::Load(delayed);
+			SIMDFloat z0 = SIMDFloat::Load(z[0]), z1 = SIMDFloat::Load(z[1]), z2 = SIMDFloat::Load(z[2]), z3 = SIMDFloat::Load(z[3]), z4 = SIMDFloat::Load(z[4]);
+			for (size_t i = 0; i < count; ++i)
+			{
+				fb = fb + fb_step;
+				tunev = tunev + tunes;
+				SIMDFloat const input = GatherLanes(buffer, i);
+				SIMDFloat const input_adjusted = drive * (input + input * fb * SIMDFloat(GAIN_COMPENSATION));
+				for (int o = 0; o < 2; ++o)
+				{
+					del = SIMDFloat(0.5f) * (y4 + prev);
+					prev = y4;
+					y0 = input_adjusted - fb * del;
+					z0 = FastTanh(y0 * scale);
+					y1 = y1 + tunev * (z0 - z1);
+					z1 = FastTanh(y1 * scale);
+					y2 = y2 + tunev * (z1 - z2);
+					z2 = FastTanh(y2 * scale);
+					y3 = y3 + tunev * (z2 - z3);
+					z3 = FastTanh(y3 * scale);
+					y4 = y4 + tunev * (z3 - z4);
+					z4 = FastTanh(y4 * scale);
+				}
+				ScatterLanes(buffer, i, y0 * mix0 + y1 * mix1 + y2 * mix2 + y3 * mix3 + y4 * mix4);
+			}
+			prev.Store(previous); del.Store(delayed);
+			tunev.Store(tune);
+			z0.Store(z[0]); z1.Store(z[1]); z2.Store(z[2]); z3.Store(z[3]); z4.Store(z[4]);
+		}
+		break;
+
+	case FILTER_TPT_MOOG:
+		{
+			SIMDFloat inv1gv = SIMDFloat::Load(inv1g), Gv = SIMDFloat::Load(G), alpha0v = SIMDFloat::Load(alpha0);
+			SIMDFloat const inv1gs = SIMDFloat::Load(inv1g_step), Gs = SIMDFloat::Load(G_step), alpha0s = SIMDFloat::Load(alpha0_step);
+			SIMDFloat z0 = SIMDFloat::Load(z[0]), z1 = SIMDFloat::Load(z[1]), z2 = SIMDFloat::Load(z[2]), z3 = SIMDFloat::Load(z[3]);
+			for (size_t i = 0; i < count; ++i)
+			{
+				fb = fb + fb_step;
+				inv1gv = inv1gv + inv1gs; Gv = Gv + Gs; alpha0v = alpha0v + alpha0s;
+				SIMDFloat const input = GatherLanes(buffer, i);
+				SIMDFloat const input_adjusted = drive * (input + input * fb * SIMDFloat(GAIN_COMPENSATION));
+				SIMDFloat const S = (((z0 * Gv + z1) * Gv + z2) * Gv + z3) * inv1gv;
+#if SATURATE == SATURATE_INPUT
+				y0 = Saturate(alpha0v * (input_adjusted - fb * S));
+#else
+				y0 = alpha0v * (input_adjusted - fb * Saturate(S));
+#endif
+				SIMDFloat v;
+				v = (y0 - z0) * Gv;
+				y1 = v + z0;
+				z0 = y1 + v;
+				v = (y1 - z1) * Gv;
+				y2 = v + z1;
+				z1 = y2 + v;
+				v = (y2 - z2) * Gv;
+				y3 = v + z2;
+				z2 = y3 + v;
+				v = (y3 - z3) * Gv;
+				y4 = v + z3;
+				z3 = y4 + v;
+				ScatterLanes(buffer, i, y0 * mix0 + y1 * mix1 + y2 * mix2 + y3 * mix3 + y4 * mix4);
+			}
+			z0.Store(z[0]); z1.Store(z[1]); z2.Store(z[2]); z3.Store(z[3]);
+			inv1gv.Store(inv1g); Gv.Store(G); alpha0v.Store(alpha0);
+		}
+		break;
+	}
+
+	y0.Store(y[0]); y1.Store(y[1]); y2.Store(y[2]); y3.Store(y[3]); y4.Store(y[4]);
+
+	// the ramps are done
+	fb.Store(feedback);
+	memset(feedback_step, 0, sizeof(feedback_step));
+	memset(a1_step, 0, sizeof(a1_step)); memset(b0_step, 0, sizeof(b0_step)); memset(b1_step, 0, sizeof(b1_step));
+	memset(tune_step, 0, sizeof(tune_step));
+	memset(inv1g_step, 0, sizeof(inv1g_step)); memset(G_step, 0, sizeof(G_step)); memset(alpha0_step, 0, sizeof(alpha0_step));
+}
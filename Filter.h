@@ -1,179 +1,231 @@
-#pragma once
-/*
-MINI VIRTUAL ANALOG SYNTHESIZER
-Copyright 2014 Kenneth D. Miller III
-
-Filter
-*/
-
-#include "Envelope.h"
-
-// filter type
-#define FILTER_IMPROVED_MOOG 0
-#define FILTER_LINEAR_MOOG 1
-#define FILTER_NONLINEAR_MOOG 2
-#define FILTER_TPT_MOOG 3
-#define FILTER 3
-
-// resonant lowpass filter
-class FilterConfig
-{
-public:
-	bool enable;
-	enum Mode
-	{
-		PEAK,
-		LOWPASS_1,
-		LOWPASS_2,
-		LOWPASS_3,
-		LOWPASS_4,
-		HIGHPASS_1,
-		HIGHPASS_2,
-		HIGHPASS_3,
-		HIGHPASS_4,
-		BANDPASS_1,
-		BANDPASS_1_LOWPASS_1,
-		BANDPASS_1_LOWPASS_2,
-		BANDPASS_1_HIGHPASS_1,
-		BANDPASS_1_HIGHPASS_2,
-		BANDPASS_2,
-		NOTCH_1,
-		NOTCH_1_LOWPASS_1,
-		NOTCH_1_LOWPASS_2,
-		NOTCH_1_HIGHPASS_1,
-		NOTCH_1_HIGHPASS_2,
-		NOTCH_2,
-		PHASESHIFT_1,
-		PHASESHIFT_2,
-		PHASESHIFT_3,
-		PHASESHIFT_4,
-
-		COUNT
-	};
-	Mode mode;
-	float mix[5];
-
-	// drive parameter
-	float drive;
-
-	// resonance parameter
-	float resonance;
-
-	// cutoff frequency (logarithmic)
-	float cutoff_base;
-	float cutoff_lfo;
-	float cutoff_env;
-	float cutoff_env_vel;
-
-	// key follow
-	float key_follow;
-
-	FilterConfig(bool const enable, Mode const mode, float const drive, float const resonance, float const cutoff_base, float const cutoff_lfo, float const cutoff_env, float const cutoff_env_vel, float const key_follow)
-		: enable(enable)
-		, drive(drive)
-		, resonance(resonance)
-		, cutoff_base(cutoff_base)
-		, cutoff_lfo(cutoff_lfo)
-		, cutoff_env(cutoff_env)
-		, cutoff_env_vel(cutoff_env_vel)
-		, key_follow(key_follow)
-	{
-		SetMode(mode);
-	}
-
-	// set filter mode
-	void SetMode(Mode newmode);
-
-	// get the modulated cutoff value
-	float GetCutoff(float const lfo, float const env, float const vel)
-	{
-		return powf(2, cutoff_base + lfo * cutoff_lfo + env * (cutoff_env + vel * cutoff_env_vel));
-	}
-};
-
-// filter state
-class FilterState
-{
-public:
-	// feedback coefficient
-	float feedback;
-
-#if FILTER == FILTER_NONLINEAR_MOOG
-
-#define FILTER_OVERSAMPLE 2
-
-	// output delayed by half a sample for phase compensation
-	float previous;
-	float delayed;
-
-	// tuning coefficient
-	float tune;
-
-	// nonlinear output values from each stage
-	float z[5];
-
-#elif FILTER == FILTER_LINEAR_MOOG
-
-#define FILTER_OVERSAMPLE 2
-
-	// output delayed by half a sample for phase compensation
-	float previous;
-	float delayed;
-
-	// tuning coefficient
-	float tune;
-
-#elif FILTER == FILTER_IMPROVED_MOOG
-
-#define FILTER_OVERSAMPLE 2
-
-	// filter stage IIR coefficients
-	// H(z) = (b0 * z + b1) / (z + a1)
-	// H(z) = (b0 + b1 * z^-1) / (1 + a1 * z-1)
-	// H(z) = Y(z) / X(z)
-	// Y(z) = b0 + b1 * z^-1
-	// X(z) = 1 + a1 * z^-1
-	// (1 + a1 * z^-1) * Y(z) = (b0 + b1 * z^-1) * X(z)
-	// y[n] + a1 * y[n - 1] = b0 * x[n] + b1 * x[n - 1]
-	// y[n] = b0 * x[n] + b1 * x[n-1] - a1 * y[n-1]
-	float b0, b1, a1;
-
-#elif FILTER == FILTER_TPT_MOOG
-
-#define FILTER_OVERSAMPLE 1
-
-	// parameters derived from cutoff and resonance
-	float inv1g, G, alpha0;
-
-	// delay element values
-	float z[4];
-
-#endif
-
-	// linear output values from each stage
-	// (y[0] is input to the first stage)
-	float y[5];
-
-	FilterState()
-	{
-		Reset();
-	}
-	void Reset(void);
-	void Setup(float const cutoff, float const resonance, float const step);
-	float Update(FilterConfig const &config, float const input);
-};
-
-// filter mode names
-extern char const * const filter_name[FilterConfig::COUNT];
-
-// filter configuration
-extern FilterConfig flt_config;
-
-// filter envelope configuration
-extern EnvelopeConfig flt_env_config;
-
-// filter state
-extern FilterState flt_state[];
-
-// filter envelope state
-extern EnvelopeState flt_env_state[];
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Filter
+*/
+
+#include "Envelope.h"
+#include "SIMD.h"
+
+// filter models
+// (selected per patch; see FilterConfig::model)
+#define FILTER_IMPROVED_MOOG 0
+#define FILTER_LINEAR_MOOG 1
+#define FILTER_NONLINEAR_MOOG 2
+#define FILTER_TPT_MOOG 3
+#define FILTER_MODEL_COUNT 4
+
+// default filter model
+#define FILTER FILTER_TPT_MOOG
+
+// resonant lowpass filter
+class FilterConfig
+{
+public:
+	bool enable;
+	enum Mode
+	{
+		PEAK,
+		LOWPASS_1,
+		LOWPASS_2,
+		LOWPASS_3,
+		LOWPASS_4,
+		HIGHPASS_1,
+		HIGHPASS_2,
+		HIGHPASS_3,
+		HIGHPASS_4,
+		BANDPASS_1,
+		BANDPASS_1_LOWPASS_1,
+		BANDPASS_1_LOWPASS_2,
+		BANDPASS_1_HIGHPASS_1,
+		BANDPASS_1_HIGHPASS_2,
+		BANDPASS_2,
+		NOTCH_1,
+		NOTCH_1_LOWPASS_1,
+		NOTCH_1_LOWPASS_2,
+		NOTCH_1_HIGHPASS_1,
+		NOTCH_1_HIGHPASS_2,
+		NOTCH_2,
+		PHASESHIFT_1,
+		PHASESHIFT_2,
+		PHASESHIFT_3,
+		PHASESHIFT_4,
+
+		COUNT
+	};
+	Mode mode;
+	float mix[5];
+
+	// drive parameter
+	float drive;
+
+	// resonance parameter
+	float resonance;
+
+	// cutoff frequency (logarithmic)
+	float cutoff_base;
+	float cutoff_lfo;
+	float cutoff_env;
+	float cutoff_env_vel;
+
+	// key follow
+	float key_follow;
+
+	// filter topology
+	// (one of the FILTER_* model values)
+	int model;
+
+	FilterConfig(bool const enable, Mode const mode, float const drive, float const resonance, float const cutoff_base, float const cutoff_lfo, float const cutoff_env, float const cutoff_env_vel, float const key_follow)
+		: enable(enable)
+		, drive(drive)
+		, resonance(resonance)
+		, cutoff_base(cutoff_base)
+		, cutoff_lfo(cutoff_lfo)
+		, cutoff_env(cutoff_env)
+		, cutoff_env_vel(cutoff_env_vel)
+		, key_follow(key_follow)
+		, model(FILTER)
+	{
+		SetMode(mode);
+	}
+
+	// set filter mode
+	void SetMode(Mode newmode);
+
+	// get the modulated cutoff value in octaves
+	float GetCutoffOctaves(float const lfo, float const env, float const vel) const
+	{
+		return cutoff_base + lfo * cutoff_lfo + env * (cutoff_env + vel * cutoff_env_vel);
+	}
+
+	// get the modulated cutoff value
+	float GetCutoff(float const lfo, float const env, float const vel) const
+	{
+		return FastExp2(GetCutoffOctaves(lfo, env, vel));
+	}
+};
+
+// filter state
+// (the same layout for every model; each model uses its own subset)
+class FilterState
+{
+public:
+	// feedback coefficient
+	float feedback;
+
+	// improved moog stage IIR coefficients
+	// H(z) = (b0 * z + b1) / (z + a1)
+	// H(z) = (b0 + b1 * z^-1) / (1 + a1 * z-1)
+	// H(z) = Y(z) / X(z)
+	// Y(z) = b0 + b1 * z^-1
+	// X(z) = 1 + a1 * z^-1
+	// (1 + a1 * z^-1) * Y(z) = (b0 + b1 * z^-1) * X(z)
+	// y[n] + a1 * y[n - 1] = b0 * x[n] + b1 * x[n - 1]
+	// y[n] = b0 * x[n] + b1 * x[n-1] - a1 * y[n-1]
+	float b0, b1, a1;
+
+	// huovilainen output delayed by half a sample for phase compensation
+	float previous;
+	float delayed;
+
+	// huovilainen tuning coefficient
+	float tune;
+
+	// tpt parameters derived from cutoff and resonance
+	float inv1g, G, alpha0;
+
+	// nonlinear output values from each stage (nonlinear huovilainen)
+	// or delay element values (tpt)
+	float z[5];
+
+	// linear output values from each stage
+	// (y[0] is input to the first stage)
+	float y[5];
+
+	FilterState()
+	{
+		Reset();
+	}
+	void Reset(void);
+	void Setup(int const model, float const cutoff, float const resonance, float const step);
+	float Update(FilterConfig const &config, float const input);
+
+	// filter a block of samples in place
+	void Render(FilterConfig const &config, float buffer[], size_t count);
+};
+
+// voices per filter bank
+#define FILTER_LANES SIMD_WIDTH
+
+// filter bank
+// (structure-of-arrays filter state for FILTER_LANES voices,
+// updated together by each vector operation)
+class SIMD_ALIGN FilterBank
+{
+public:
+	// feedback coefficient
+	float feedback[FILTER_LANES];
+
+	// improved moog stage IIR coefficients
+	float b0[FILTER_LANES], b1[FILTER_LANES], a1[FILTER_LANES];
+
+	// huovilainen output delayed by half a sample and tuning coefficient
+	float previous[FILTER_LANES], delayed[FILTER_LANES], tune[FILTER_LANES];
+
+	// tpt parameters derived from cutoff and resonance
+	float inv1g[FILTER_LANES], G[FILTER_LANES], alpha0[FILTER_LANES];
+
+	// nonlinear output values or delay element values
+	float z[5][FILTER_LANES];
+
+	// linear output values from each stage
+	// (y[0] is input to the first stage)
+	float y[5][FILTER_LANES];
+
+	// per-sample coefficient changes for ramping to new settings
+	// (cleared at the end of each Render)
+	float feedback_step[FILTER_LANES];
+	float b0_step[FILTER_LANES], b1_step[FILTER_LANES], a1_step[FILTER_LANES];
+	float tune_step[FILTER_LANES];
+	float inv1g_step[FILTER_LANES], G_step[FILTER_LANES], alpha0_step[FILTER_LANES];
+
+	// set once a lane has coefficients to ramp from
+	bool primed[FILTER_LANES];
+
+	FilterBank()
+	{
+		for (int lane = 0; lane < FILTER_LANES; ++lane)
+			Reset(lane);
+	}
+	void Reset(int const lane);
+	// (ramps to the new coefficients over the given number of samples)
+	void Setup(int const lane, int const model, float const cutoff, float const resonance, float const step, size_t const ramp = 0);
+
+	// filter a block of samples in place for each lane
+	// (lanes with a null buffer filter silence)
+	void Render(FilterConfig const &config, float * const buffer[FILTER_LANES], size_t count);
+};
+
+// build the filter coefficient tables
+extern void InitFilter();
+
+// filter mode names
+extern char const * const filter_name[FilterConfig::COUNT];
+
+// filter model names
+extern char const * const filter_model_name[FILTER_MODEL_COUNT];
+
+// filter configuration
+extern FilterConfig flt_config;
+
+// filter envelope configuration
+extern EnvelopeConfig flt_env_config;
+
+// filter banks
+// (voice v uses lane v % FILTER_LANES of bank v / FILTER_LANES)
+extern FilterBank flt_bank[];
+
+// filter envelope state
+extern EnvelopeState flt_env_state[];
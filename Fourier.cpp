@@ -0,0 +1,51 @@
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Fast Fourier Transform
+*/
+#include "Platform.h"
+
+#include "Fourier.h"
+
+// in-place complex fast Fourier transform
+// (radix-2 decimation in time)
+void TransformFourier(double real[], double imag[], int const count, bool const inverse)
+{
+	// bit-reversal permutation
+	for (int i = 1, j = 0; i < count; ++i)
+	{
+		int bit = count >> 1;
+		for (; j & bit; bit >>= 1)
+			j ^= bit;
+		j |= bit;
+		if (i < j)
+		{
+			double t = real[i]; real[i] = real[j]; real[j] = t;
+			t = imag[i]; imag[i] = imag[j]; imag[j] = t;
+		}
+	}
+
+	// butterflies
+	for (int length = 2; length <= count; length <<= 1)
+	{
+		double const angle = (inverse ? 2.0 : -2.0) * M_PI / length;
+		for (int k = 0; k < length / 2; ++k)
+		{
+			// twiddle factor shared by every block
+			double const w_real = cos(angle * k);
+			double const w_imag = sin(angle * k);
+			for (int start = 0; start < count; start += length)
+			{
+				int const a = start + k;
+				int const b = a + length / 2;
+				double const t_real = real[b] * w_real - imag[b] * w_imag;
+				double const t_imag = real[b] * w_imag + imag[b] * w_real;
+				real[b] = real[a] - t_real;
+				imag[b] = imag[a] - t_imag;
+				real[a] += t_real;
+				imag[a] += t_imag;
+			}
+		}
+	}
+}
@@ -0,0 +1,11 @@
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Fast Fourier Transform
+*/
+
+// in-place complex fast Fourier transform
+// (count is a power of two; the inverse is not scaled)
+extern void TransformFourier(double real[], double imag[], int const count, bool const inverse);
@@ -0,0 +1,82 @@
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Memory-Mapped File
+*/
+#include "Platform.h"
+
+#include "MappedFile.h"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// map a file
+bool MappedFile::Open(char const *filename)
+{
+	Close();
+
+#if defined(_WIN32)
+	HANDLE const file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+	LARGE_INTEGER file_size;
+	if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0)
+	{
+		CloseHandle(file);
+		return false;
+	}
+	mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	CloseHandle(file);
+	if (!mapping)
+		return false;
+	data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (!data)
+	{
+		CloseHandle(mapping);
+		mapping = NULL;
+		return false;
+	}
+	size = size_t(file_size.QuadPart);
+#else
+	int const file = open(filename, O_RDONLY);
+	if (file < 0)
+		return false;
+	struct stat info;
+	if (fstat(file, &info) != 0 || info.st_size == 0)
+	{
+		close(file);
+		return false;
+	}
+	void *const view = mmap(NULL, size_t(info.st_size), PROT_READ, MAP_SHARED, file, 0);
+	close(file);
+	if (view == MAP_FAILED)
+		return false;
+	data = view;
+	size = size_t(info.st_size);
+#endif
+	return true;
+}
+
+// unmap the file
+void MappedFile::Close()
+{
+	if (!data)
+		return;
+#if defined(_WIN32)
+	UnmapViewOfFile(data);
+	CloseHandle(mapping);
+	mapping = NULL;
+#else
+	munmap(const_cast<void *>(data), size);
+#endif
+	data = NULL;
+	size = 0;
+}
@@ -0,0 +1,44 @@
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Memory-Mapped File
+*/
+
+// read-only view of a whole file
+// (the operating system shares the pages between every process that
+// maps the same file, and loads them on first use)
+class MappedFile
+{
+public:
+	void const *data;
+	size_t size;
+
+	MappedFile()
+		: data(NULL)
+		, size(0)
+		, mapping(NULL)
+	{
+	}
+
+	~MappedFile()
+	{
+		Close();
+	}
+
+	// map a file
+	// (returns false if the file could not be opened or is empty)
+	bool Open(char const *filename);
+
+	// unmap the file
+	void Close();
+
+private:
+	// operating system mapping handle
+	void *mapping;
+
+	// not copyable
+	MappedFile(MappedFile const &);
+	MappedFile &operator=(MappedFile const &);
+};
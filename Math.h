@@ -1,160 +1,243 @@
-#pragma once
-/*
-MINI VIRTUAL ANALOG SYNTHESIZER
-Copyright 2014 Kenneth D. Miller III
-
-Math Functions
-*/
-
-#ifndef M_PI
-#define M_PI 3.14159265358979323846f
-#endif
-
-// square a value
-// (useful when x is a long or compicated expression)
-template<typename T> static inline T Squared(T x)
-{
-	return x * x;
-}
-
-// clamp value x between lower bound a and upper bound b
-template<typename T> static inline T Clamp(T x, T a, T b)
-{
-	if (x < a)
-		return a;
-	if (x > b)
-		return b;
-	return x;
-}
-
-// get minimum of a and b
-template<typename T> static inline T Min(T a, T b)
-{
-	return a < b ? a : b;
-}
-
-// get maximum of a and b
-template<typename T> static inline T Max(T a, T b)
-{
-	return a > b ? a : b;
-}
-
-// linear interpolation
-template<typename T> inline T Lerp(const T v0, const T v1, const float s)
-{
-	return v0 + (v1 - v0) * s;
-}
-
-// fast approximation of tanh()
-static inline float FastTanh(float x)
-{
-#if 0
-	if (fabsf(x) < 1.5f)
-		return x - 0.14814814814814814814814814814815f * x * x * x;
-	return x > 0 ? 1 : -1;
-#else
-	if (x < -3)
-		return -1;
-	if (x > 3)
-		return 1;
-	return x * (27 + x * x) / (27 + 9 * x * x);
-#endif
-}
-
-// Fast float-to-integer conversions based on an article by Laurent de Soras
-// http://ldesoras.free.fr/doc/articles/rounding_en.pdf
-// The input value must be in the interval [-2**30, 2**30-1]
-
-#if _M_IX86_FP > 0
-#include <xmmintrin.h>
-#endif
-
-// fast integer round
-static inline int RoundInt(float const x)
-{
-#if 0//_M_IX86_FP > 0
-	return int(roundf(x));
-#elif _M_IX86_FP > 0
-	register __m128 xx = _mm_load_ss(&x);
-	return _mm_cvtss_si32(_mm_add_ss(_mm_add_ss(xx, xx), _mm_set_ss(0.5f))) >> 1;
-#else
-	float const round_nearest = 0.5f;
-	int i;
-	__asm
-	{
-		fld x;
-		fadd st, st(0);
-		fadd round_nearest;
-		fistp i;
-		sar i, 1;
-	}
-	return i;
-#endif
-}
-
-// fast integer floor
-static inline int FloorInt(float const x)
-{
-#if 0//_M_IX86_FP > 0
-	return int(floorf(x));
-#elif _M_IX86_FP > 0
-	register __m128 xx = _mm_load_ss(&x);
-	return _mm_cvtss_si32(_mm_add_ss(_mm_add_ss(xx, xx), _mm_set_ss(-0.5f))) >> 1;
-#else
-	float const round_minus_infinity = -0.5f;
-	int i;
-	__asm
-	{
-		fld x;
-		fadd st, st(0);
-		fadd round_minus_infinity;
-		fistp i;
-		sar i, 1;
-	}
-	return i;
-#endif
-}
-
-// fast integer ceiling
-static inline int CeilingInt(float const x)
-{
-#if 0//_M_IX86_FP > 0
-	return int(ceilf(x));
-#elif _M_IX86_FP > 0
-	register __m128 xx = _mm_load_ss(&x);
-	return -(_mm_cvtss_si32(_mm_sub_ss(_mm_set_ss(-0.5f), _mm_add_ss(xx, xx))) >> 1);
-#else
-	float const round_plus_infinity = -0.5f;
-	int i;
-	__asm
-	{
-		fld x;
-		fadd st, st(0);
-		fsubr round_plus_infinity;
-		fistp i;
-		sar i, 1;
-	}
-	return -i;
-#endif
-}
-
-// fast integer truncate
-static inline int TruncateInt(float const x)
-{
-#if _M_IX86_FP > 0
-	return int(x);
-#else
-	float const round_minus_infinity = -0.5f;
-	int i;
-	__asm
-	{
-		fld x;
-		fadd st, st(0);
-		fabs;
-		fadd round_minus_infinity;
-		fistp i;
-		sar i, 1;
-	}
-	return x >= 0 ? i : -i;
-#endif
-}
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Math Functions
+*/
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846f
+#endif
+
+// square a value
+// (useful when x is a long or compicated expression)
+template<typename T> static inline T Squared(T x)
+{
+	return x * x;
+}
+
+// clamp value x between lower bound a and upper bound b
+template<typename T> static inline T Clamp(T x, T a, T b)
+{
+	if (x < a)
+		return a;
+	if (x > b)
+		return b;
+	return x;
+}
+
+// get minimum of a and b
+template<typename T> static inline T Min(T a, T b)
+{
+	return a < b ? a : b;
+}
+
+// get maximum of a and b
+template<typename T> static inline T Max(T a, T b)
+{
+	return a > b ? a : b;
+}
+
+// linear interpolation
+template<typename T> inline T Lerp(const T v0, const T v1, const float s)
+{
+	return v0 + (v1 - v0) * s;
+}
+
+// fast approximation of tanh()
+// (rational approximation clamped to [-3, 3] without branches;
+// absolute error below 0.0236, largest near x = +/-1.57)
+static inline float FastTanh(float x)
+{
+#if 0
+	if (fabsf(x) < 1.5f)
+		return x - 0.14814814814814814814814814814815f * x * x * x;
+	return x > 0 ? 1 : -1;
+#else
+	x = Clamp(x, -3.0f, 3.0f);
+	return x * (27 + x * x) / (27 + 9 * x * x);
+#endif
+}
+
+// Fast float-to-integer conversions based on an article by Laurent de Soras
+// http://ldesoras.free.fr/doc/articles/rounding_en.pdf
+// The input value must be in the interval [-2**30, 2**30-1]
+
+// Each conversion rounds a doubled and biased value to the nearest integer
+// and halves the result, so every implementation gives the same results:
+// - RoundInt returns floor(x + 0.5), except that the largest float below
+//   0.5 rounds to 1 because doubling and biasing it rounds to 1.5
+// - TruncateInt returns the integer part of x
+// - FloorInt and CeilingInt return floor(x) and ceil(x), except that values
+//   within 2**-26 of zero on the far side return 0 because the bias absorbs
+//   them; this keeps x - FloorInt(x) below 1 when wrapping phases
+// (SIMD.h has vector and array versions with the same results)
+
+// use SSE scalar conversions where available,
+// x87 assembly on 32-bit Visual C++ without SSE,
+// and the same arithmetic with the standard library everywhere else
+#if defined(_M_X64) || _M_IX86_FP > 0 || defined(__SSE__)
+#include <xmmintrin.h>
+#define MATH_CONVERT_SSE
+#elif defined(_M_IX86)
+#define MATH_CONVERT_X87
+#endif
+
+// fast integer round
+static inline int RoundInt(float const x)
+{
+#if 0//_M_IX86_FP > 0
+	return int(roundf(x));
+#elif defined(MATH_CONVERT_SSE)
+	__m128 xx = _mm_load_ss(&x);
+	return _mm_cvtss_si32(_mm_add_ss(_mm_add_ss(xx, xx), _mm_set_ss(0.5f))) >> 1;
+#elif defined(MATH_CONVERT_X87)
+	float const round_nearest = 0.5f;
+	int i;
+	__asm
+	{
+		fld x;
+		fadd st, st(0);
+		fadd round_nearest;
+		fistp i;
+		sar i, 1;
+	}
+	return i;
+#else
+	return int(lrintf(x + x + 0.5f)) >> 1;
+#endif
+}
+
+// fast integer floor
+static inline int FloorInt(float const x)
+{
+#if 0//_M_IX86_FP > 0
+	return int(floorf(x));
+#elif defined(MATH_CONVERT_SSE)
+	__m128 xx = _mm_load_ss(&x);
+	return _mm_cvtss_si32(_mm_add_ss(_mm_add_ss(xx, xx), _mm_set_ss(-0.5f))) >> 1;
+#elif defined(MATH_CONVERT_X87)
+	float const round_minus_infinity = -0.5f;
+	int i;
+	__asm
+	{
+		fld x;
+		fadd st, st(0);
+		fadd round_minus_infinity;
+		fistp i;
+		sar i, 1;
+	}
+	return i;
+#else
+	return int(lrintf(x + x - 0.5f)) >> 1;
+#endif
+}
+
+// fast integer ceiling
+static inline int CeilingInt(float const x)
+{
+#if 0//_M_IX86_FP > 0
+	return int(ceilf(x));
+#elif defined(MATH_CONVERT_SSE)
+	__m128 xx = _mm_load_ss(&x);
+	return -(_mm_cvtss_si32(_mm_sub_ss(_mm_set_ss(-0.5f), _mm_add_ss(xx, xx))) >> 1);
+#elif defined(MATH_CONVERT_X87)
+	float const round_plus_infinity = -0.5f;
+	int i;
+	__asm
+	{
+		fld x;
+		fadd st, st(0);
+		fsubr round_plus_infinity;
+		fistp i;
+		sar i, 1;
+	}
+	return -i;
+#else
+	return -(int(lrintf(-0.5f - (x + x))) >> 1);
+#endif
+}
+
+// fast integer truncate
+static inline int TruncateInt(float const x)
+{
+#if !defined(MATH_CONVERT_X87)
+	return int(x);
+#else
+	float const round_minus_infinity = -0.5f;
+	int i;
+	__asm
+	{
+		fld x;
+		fadd st, st(0);
+		fabs;
+		fadd round_minus_infinity;
+		fistp i;
+		sar i, 1;
+	}
+	return x >= 0 ? i : -i;
+#endif
+}
+
+// polynomial approximation of 2**x for x in [0, 1)
+// (shared by the scalar and vector versions of FastExp2;
+// Chebyshev fit with relative error below 1.1e-7)
+template<typename T> static inline T Exp2Polynomial(T const x)
+{
+	return T(0.999999898f) + x * (T(0.69315449f) + x * (T(0.240141818f) + x * (T(0.0558603371f) + x * (T(0.00894959042f) + x * T(0.00189375406f)))));
+}
+
+// polynomial approximation of log2(1 + x) / x for x in [sqrt(1/2) - 1, sqrt(2) - 1)
+// (shared by the scalar and vector versions of FastLog2;
+// Chebyshev fit with absolute error in log2 below 6.3e-7)
+template<typename T> static inline T Log2Polynomial(T const x)
+{
+	return T(1.44269652f) + x * (T(-0.721360179f) + x * (T(0.480613125f) + x * (T(-0.359524455f) + x * (T(0.296119557f) + x * (T(-0.267963871f) + x * T(0.168186591f))))));
+}
+
+// fast approximation of 2**x
+// (relative error below 2e-7; x is clamped to [-126, 126])
+static inline float FastExp2(float x)
+{
+	x = Clamp(x, -126.0f, 126.0f);
+	int const i = FloorInt(x);
+	union { float f; int i; } scale;
+	scale.i = (i + 127) << 23;
+	return Exp2Polynomial(x - i) * scale.f;
+}
+
+// fast approximation of log2(x)
+// (absolute error below 7e-7 plus rounding of the result for positive normal x)
+static inline float FastLog2(float const x)
+{
+	// split into exponent and mantissa in [sqrt(1/2), sqrt(2))
+	union { float f; int i; } bits = { x };
+	int e = ((bits.i >> 23) & 0xFF) - 127;
+	bits.i = (bits.i & 0x007FFFFF) | 0x3F800000;
+	if (bits.f >= 1.41421356f)
+	{
+		bits.f *= 0.5f;
+		++e;
+	}
+	float const m = bits.f - 1.0f;
+	return e + m * Log2Polynomial(m);
+}
+
+// polynomial approximation of sin(pi/2 * x) for x in [-1, 1]
+// (shared by the scalar and vector versions of FastSine;
+// odd minimax fit with absolute error below 6e-7)
+template<typename T> static inline T SinePolynomial(T const x)
+{
+	T const x2 = x * x;
+	return x * (T(1.57079101f) + x2 * (T(-0.64589285f) + x2 * (T(0.0794343446f) + x2 * T(-0.00433309529f))));
+}
+
+// fast approximation of sin(2 * pi * phase)
+// (folds the phase into a triangle wave in [-1, 1] that matches the
+// sine in every quadrant; absolute error below 1e-6 for phases in [-16, 16])
+static inline float FastSine(float const phase)
+{
+	float const x = fabsf(4 * (phase - FloorInt(phase - 0.25f)) - 3) - 1;
+	return SinePolynomial(x);
+}
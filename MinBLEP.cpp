@@ -0,0 +1,109 @@
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Minimum-Phase Bandlimited Step
+(based on Brandt, "Hard Sync Without Aliasing")
+*/
+#include "Platform.h"
+
+#include "MinBLEP.h"
+#include "Fourier.h"
+#include "WaveCache.h"
+
+// step residual table
+float minblep_residual[MINBLEP_OVERSAMPLE + 1][MINBLEP_LENGTH];
+
+// impulse response length in table positions
+#define MINBLEP_TAPS (MINBLEP_LENGTH * MINBLEP_OVERSAMPLE)
+
+// Fourier transform size for the cepstrum
+// (padding well past the impulse keeps the folded cepstrum from aliasing)
+#define MINBLEP_FOURIER_SIZE (MINBLEP_TAPS * 8)
+
+// lowpass cutoff relative to the Nyquist frequency
+// (the window transition band is wide for so short a step, and ends
+// near the Nyquist frequency from here: 0.9 aliases 30 dB more)
+static const double MINBLEP_CUTOFF = 0.8;
+
+// build the step residual table
+// (data holds a table shaped like minblep_residual)
+static void BuildMinBLEP(void *data)
+{
+	float (* const residual)[MINBLEP_LENGTH] = static_cast<float (*)[MINBLEP_LENGTH]>(data);
+
+	static double real[MINBLEP_FOURIER_SIZE], imag[MINBLEP_FOURIER_SIZE];
+
+	// Blackman-windowed sinc lowpass impulse centered in the taps
+	memset(real, 0, sizeof(real));
+	memset(imag, 0, sizeof(imag));
+	for (int i = 0; i < MINBLEP_TAPS; ++i)
+	{
+		double const t = MINBLEP_CUTOFF * (i - MINBLEP_TAPS / 2) / MINBLEP_OVERSAMPLE;
+		double const sinc = t == 0.0 ? 1.0 : sin(M_PI * t) / (M_PI * t);
+		double const w = 2.0 * M_PI * i / MINBLEP_TAPS;
+		double const window = 0.42 - 0.5 * cos(w) + 0.08 * cos(w + w);
+		real[i] = sinc * window;
+	}
+
+	// real cepstrum: inverse transform of the log magnitude
+	TransformFourier(real, imag, MINBLEP_FOURIER_SIZE, false);
+	for (int k = 0; k < MINBLEP_FOURIER_SIZE; ++k)
+	{
+		real[k] = log(Max(sqrt(real[k] * real[k] + imag[k] * imag[k]), 1e-12));
+		imag[k] = 0.0;
+	}
+	TransformFourier(real, imag, MINBLEP_FOURIER_SIZE, true);
+
+	// fold the cepstrum onto positive quefrencies for minimum phase
+	for (int k = 1; k < MINBLEP_FOURIER_SIZE / 2; ++k)
+		real[k] *= 2.0;
+	for (int k = MINBLEP_FOURIER_SIZE / 2 + 1; k < MINBLEP_FOURIER_SIZE; ++k)
+		real[k] = 0.0;
+	for (int k = 0; k < MINBLEP_FOURIER_SIZE; ++k)
+	{
+		real[k] /= MINBLEP_FOURIER_SIZE;
+		imag[k] = 0.0;
+	}
+
+	// complex exponential of the spectrum gives the minimum-phase impulse
+	TransformFourier(real, imag, MINBLEP_FOURIER_SIZE, false);
+	for (int k = 0; k < MINBLEP_FOURIER_SIZE; ++k)
+	{
+		double const magnitude = exp(real[k]);
+		real[k] = magnitude * cos(imag[k]);
+		imag[k] = magnitude * sin(imag[k]);
+	}
+	TransformFourier(real, imag, MINBLEP_FOURIER_SIZE, true);
+
+	// integrate the impulse into a step that settles at 1
+	double sum = 0.0;
+	for (int i = 0; i < MINBLEP_TAPS; ++i)
+	{
+		sum += real[i];
+		real[i] = sum;
+	}
+
+	// residual after the step
+	// (the last table position is a whole step length after the step)
+	for (int p = 0; p <= MINBLEP_OVERSAMPLE; ++p)
+	{
+		for (int j = 0; j < MINBLEP_LENGTH; ++j)
+		{
+			int const i = j * MINBLEP_OVERSAMPLE + p;
+			residual[p][j] = i < MINBLEP_TAPS ? float(real[i] / sum - 1.0) : 0.0f;
+		}
+	}
+}
+
+// build the step residual table
+// (or read it from the wave cache; the name records the table parameters)
+void InitMinBLEP()
+{
+	char name[64];
+	sprintf(name, "minblep-%dx%d-%.2f", MINBLEP_LENGTH, MINBLEP_OVERSAMPLE, MINBLEP_CUTOFF);
+	MappedFile cache;
+	void const *data = MapWaveCache(cache, name, sizeof(minblep_residual), BuildMinBLEP, minblep_residual);
+	if (data != minblep_residual)
+		memcpy(minblep_residual, data, sizeof(minblep_residual));
+}
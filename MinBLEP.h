@@ -0,0 +1,75 @@
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Minimum-Phase Bandlimited Step
+(based on Brandt, "Hard Sync Without Aliasing")
+*/
+
+#include "Math.h"
+
+// MinBLEP
+// Table of the difference between a minimum-phase bandlimited step and
+// an ideal step, added to the output after each discontinuity
+
+// unlike PolyBLEP, the correction only follows the step, so it can be
+// added when the step happens instead of searching for steps ahead of
+// the current phase; each step costs one table add however many edges
+// the wave has
+
+// samples in the step residual
+// (a power of two)
+#define MINBLEP_LENGTH 32
+
+// table positions per sample
+#define MINBLEP_OVERSAMPLE 64
+
+// step residual table
+// (row p holds the residual p / MINBLEP_OVERSAMPLE samples after a
+// unit step, and each whole sample after that)
+extern float minblep_residual[MINBLEP_OVERSAMPLE + 1][MINBLEP_LENGTH];
+
+// build the step residual table
+extern void InitMinBLEP();
+
+// step residuals still to be output
+// (a ring buffer starting at the next output sample)
+class MinBLEPBuffer
+{
+public:
+	float residual[MINBLEP_LENGTH];
+	int index;
+
+	void Reset()
+	{
+		memset(residual, 0, sizeof(residual));
+		index = 0;
+	}
+
+	// add a step of the given height
+	// (time is how long before the next output sample the step
+	// happened, in samples from 0 to 1)
+	void Add(float const time, float const height)
+	{
+		float const x = Clamp(time, 0.0f, 1.0f) * MINBLEP_OVERSAMPLE;
+		int const row = Min(TruncateInt(x), MINBLEP_OVERSAMPLE - 1);
+		float const s = x - row;
+		float const * const lo = minblep_residual[row];
+		float const * const hi = minblep_residual[row + 1];
+		int const wrap = MINBLEP_LENGTH - index;
+		for (int j = 0; j < wrap; ++j)
+			residual[index + j] += height * Lerp(lo[j], hi[j], s);
+		for (int j = wrap; j < MINBLEP_LENGTH; ++j)
+			residual[j - wrap] += height * Lerp(lo[j], hi[j], s);
+	}
+
+	// remove the residual for the next output sample
+	float Pop()
+	{
+		float const value = residual[index];
+		residual[index] = 0.0f;
+		index = (index + 1) & (MINBLEP_LENGTH - 1);
+		return value;
+	}
+};
@@ -0,0 +1,300 @@
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Offline Rendering
+*/
+#include "Platform.h"
+
+#include "Offline.h"
+#include "Render.h"
+#include "AudioSinkFile.h"
+#include "AudioSinkNull.h"
+#include "Math.h"
+#include "Patch.h"
+#include "Wave.h"
+#include "WaveCache.h"
+#include "Filter.h"
+#include "Tuning.h"
+#include "Voice.h"
+#include "Amplifier.h"
+#include "Control.h"
+#include "OscillatorNote.h"
+#include "WorkerPool.h"
+#include "EventQueue.h"
+#include "Benchmark.h"
+
+#include <chrono>
+
+// A note list is a text file with one note per line:
+//     <start time> <duration> <note> [velocity]
+// Times are in seconds, notes are MIDI note numbers (60 = middle C),
+// and velocity defaults to 64.  Text following '#' is ignored.
+
+// maximum number of notes in a note list
+static int const OFFLINE_MAX_NOTES = 4096;
+
+// samples queued and rendered at a time
+static size_t const OFFLINE_CHUNK_SAMPLES = 1024;
+
+// maximum time to render after the last note event
+// (in case a release never finishes)
+static float const OFFLINE_MAX_TAIL = 60.0f;
+
+// timed note event
+struct OfflineEvent
+{
+	size_t time;		// sample position
+	int note;
+	int velocity;		// zero for note off
+};
+
+static OfflineEvent events[OFFLINE_MAX_NOTES * 2];
+
+// order events by time, with note offs first
+static int CompareEvents(void const *a, void const *b)
+{
+	OfflineEvent const &ea = *static_cast<OfflineEvent const *>(a);
+	OfflineEvent const &eb = *static_cast<OfflineEvent const *>(b);
+	if (ea.time != eb.time)
+		return ea.time < eb.time ? -1 : 1;
+	return ea.velocity - eb.velocity;
+}
+
+// load note list as sorted note on and note off events
+// (returns the number of events or -1 on failure)
+static int LoadNotes(char const *filename, unsigned int frequency)
+{
+	FILE *file = fopen(filename, "r");
+	if (!file)
+	{
+		fprintf(stderr, "Can't open note list \"%s\"\n", filename);
+		return -1;
+	}
+
+	int count = 0;
+	char line[256];
+	int line_number = 0;
+	while (fgets(line, sizeof(line), file))
+	{
+		++line_number;
+
+		// strip comment
+		if (char *comment = strchr(line, '#'))
+			*comment = '\0';
+
+		float start, duration;
+		int note, velocity = 64;
+		int const fields = sscanf(line, "%f %f %d %d", &start, &duration, &note, &velocity);
+		if (fields <= 0)
+			continue;
+		if (fields < 3 || start < 0 || duration < 0 || note < 0 || note >= NOTES || velocity < 1 || velocity > 127)
+		{
+			fprintf(stderr, "%s(%d): expected <start> <duration> <note> [velocity]\n", filename, line_number);
+			continue;
+		}
+		if (count + 2 > int(ARRAY_SIZE(events)))
+		{
+			fprintf(stderr, "%s(%d): too many notes\n", filename, line_number);
+			break;
+		}
+
+		OfflineEvent &on = events[count++];
+		on.time = size_t(start * frequency + 0.5f);
+		on.note = note;
+		on.velocity = velocity;
+
+		OfflineEvent &off = events[count++];
+		off.time = size_t((start + duration) * frequency + 0.5f);
+		off.note = note;
+		off.velocity = 0;
+	}
+
+	fclose(file);
+
+	qsort(events, count, sizeof(events[0]), CompareEvents);
+
+	return count;
+}
+
+// returns true if any voice is still sounding
+// (a voice stays on the active list until the end of the block
+// where its volume envelope finishes)
+static bool AnyVoiceActive()
+{
+	for (int i = 0; i < voice_active_count; ++i)
+	{
+		if (amp_env_state[voice_active[i]].state != EnvelopeState::OFF)
+			return true;
+	}
+	return false;
+}
+
+// render samples to the audio sink
+static bool RenderToSink(AudioSink &sink, size_t count)
+{
+	static float buffer[OFFLINE_CHUNK_SAMPLES * 2];
+	while (count > 0)
+	{
+		size_t const chunk = Min(count, OFFLINE_CHUNK_SAMPLES);
+		Render(buffer, chunk);
+		if (!sink.Write(buffer, chunk))
+			return false;
+		count -= chunk;
+	}
+	return true;
+}
+
+// render a patch and a timed note list to an audio sink
+// (output "-null" discards samples as fast as possible,
+// "-paced" discards them in real time, and anything else
+// names a wave file)
+int OfflineRender(int argc, char **argv)
+{
+	if (argc < 3)
+	{
+		fprintf(stderr, "usage: synth -render <patch> <notes> <output.wav|-null|-paced> [sample rate [threads [voices [control samples [cache directory]]]]]\n");
+		return 1;
+	}
+
+	// output sample rate
+	render_frequency = argc > 3 ? atoi(argv[3]) : 48000;
+	if (render_frequency == 0)
+	{
+		fprintf(stderr, "Invalid sample rate \"%s\"\n", argv[3]);
+		return 1;
+	}
+
+	// voice rendering threads, including this one
+	// (zero or less uses every hardware thread; output does not depend on the thread count)
+	int const threads = argc > 4 ? atoi(argv[4]) : 0;
+
+	// set up voices
+	VoiceInit(argc > 5 ? atoi(argv[5]) : VOICES_DEFAULT);
+
+	// samples per control update
+	if (argc > 6)
+		SetControlSamples(atoi(argv[6]));
+
+	// directory for cached wave tables
+	// (wave tables get built on first use, and read from here if given)
+	if (argc > 7)
+		wave_cache_path = argv[7];
+
+	// initialize filter coefficient tables
+	InitFilter();
+
+	// initialize the tuning
+	InitTuning();
+
+	// enable the first oscillator
+	// (the patch may override this)
+	osc_config[0].enable = true;
+
+	// reset all controllers
+	Control::ResetAll();
+
+	// load the patch
+	if (!LoadPatch(argv[0]))
+		return 1;
+
+	// load the note list
+	int const event_count = LoadNotes(argv[1], render_frequency);
+	if (event_count < 0)
+		return 1;
+
+	// create the audio sink
+	AudioSinkFile sink_file(argv[2]);
+	AudioSinkNull sink_null;
+	AudioSinkPaced sink_paced;
+	AudioSink *sink = &sink_file;
+	if (strcmp(argv[2], "-null") == 0)
+		sink = &sink_null;
+	else if (strcmp(argv[2], "-paced") == 0)
+		sink = &sink_paced;
+	if (!sink->Open(render_frequency))
+		return 1;
+
+	// start voice rendering threads
+	WorkerInit(threads > 0 ? threads - 1 : -1);
+
+	std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+
+	// time of the last event
+	size_t const last_time = event_count > 0 ? events[event_count - 1].time : 0;
+
+	// queue the events for each chunk and render up to the last event
+	// (Render applies them at their sample positions, the same way
+	// it does for live input)
+	bool success = true;
+	size_t position = 0;
+	int e = 0;
+	while (success && position < last_time)
+	{
+		size_t chunk = Min(OFFLINE_CHUNK_SAMPLES, last_time - position);
+		for (; e < event_count && events[e].time < position + chunk; ++e)
+		{
+			OfflineEvent const &note = events[e];
+			Event const event = { note.time, note.velocity ? EVENT_NOTE_ON : EVENT_NOTE_OFF, note.note, note.velocity };
+			if (!EventPush(EVENT_SOURCE_KEYS, event))
+			{
+				// queue full: render up to the event that didn't fit
+				chunk = Max(note.time - position, size_t(1));
+				break;
+			}
+		}
+		success = RenderToSink(*sink, chunk);
+		position += chunk;
+	}
+
+	// apply the events at the last event time
+	// (directly, so the release tail below sees their effect)
+	for (; e < event_count; ++e)
+	{
+		if (events[e].velocity)
+			NoteOn(events[e].note, events[e].velocity);
+		else
+			NoteOff(events[e].note, 0);
+	}
+
+	// render the release tail
+	size_t const tail_end = position + size_t(OFFLINE_MAX_TAIL * render_frequency);
+	while (success && AnyVoiceActive() && position < tail_end)
+	{
+		success = RenderToSink(*sink, OFFLINE_CHUNK_SAMPLES);
+		position += OFFLINE_CHUNK_SAMPLES;
+	}
+
+	double const elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	sink->Close();
+
+	// stop voice rendering threads
+	int const thread_count = worker_count + 1;
+	WorkerDone();
+
+	if (!success)
+	{
+		fprintf(stderr, "Error writing output \"%s\"\n", argv[2]);
+		return 1;
+	}
+
+	// report rendering speed
+	double const duration = double(position) / render_frequency;
+	fprintf(stderr, "rendered %.3fs in %.3fs (%.1fx real time, %d thread%s)\n", duration, elapsed, elapsed > 0 ? duration / elapsed : 0.0, thread_count, thread_count > 1 ? "s" : "");
+
+	return 0;
+}
+
+#ifndef _WIN32
+// stand-alone offline renderer
+// (the interactive synthesizer requires Windows and BASS)
+int main(int argc, char **argv)
+{
+	if (argc > 1 && strcmp(argv[1], "-render") == 0)
+		return OfflineRender(argc - 2, argv + 2);
+	if (argc > 1 && strcmp(argv[1], "-bench") == 0)
+		return BenchmarkReport(argc - 2, argv + 2);
+	return OfflineRender(argc - 1, argv + 1);
+}
+#endif
@@ -0,0 +1,15 @@
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Offline Rendering
+*/
+
+// render a patch and a timed note list to a wave file
+// as fast as possible, without an audio device
+// arguments: <patch> <notes> <output.wav|-null|-paced> [sample rate
+// [threads [voices [control samples [cache directory]]]]]
+// (-null discards the samples, and -paced discards them in real time)
+// (returns the process exit code)
+extern int OfflineRender(int argc, char **argv);
@@ -1,100 +1,148 @@
-/*
-MINI VIRTUAL ANALOG SYNTHESIZER
-Copyright 2014 Kenneth D. Miller III
-
-Oscillator
-*/
-#include "StdAfx.h"
-
-#include "Oscillator.h"
-#include "Wave.h"
-#include "Math.h"
-
-// reset oscillator
-void OscillatorState::Reset()
-{
-	phase = 0.0f;
-	index = 0;
-	memset(f, 0, sizeof(f));
-}
-
-// start oscillator
-void OscillatorState::Start()
-{
-//	Reset();
-	phase = 0.0f;
-}
-
-// update oscillator
-float OscillatorState::Update(OscillatorConfig const &config, float const step)
-{
-	float const delta = config.frequency * config.adjust * step;
-
-	// compute oscillator value
-	float const value = Compute(config, delta);
-
-	// advance oscillator phase
-	Advance(config, delta);
-
-	return value;
-}
-
-// compute the oscillator value
-float OscillatorState::Compute(OscillatorConfig const &config, float delta)
-{
-	return config.amplitude * config.evaluate(config, *this, delta);
-}
-
-// advance the oscillator phase
-void OscillatorState::Advance(OscillatorConfig const &config, float delta)
-{
-	phase += delta;
-#if 1
-	int const advance = FloorInt(phase);
-	if (advance)
-	{
-		// wrap phase around
-		phase -= advance;
-
-		// advance the wavetable index
-		index += advance;
-		if (index >= int(config.cycle))
-			index -= int(config.cycle);
-		else if (index < 0)
-			index += int(config.cycle);
-	}
-	if (config.sync_enable)
-	{
-		if (phase >= config.sync_phase - index)
-		{
-			phase -= config.sync_phase - index;
-			index = 0;
-		}
-	}
-#else
-	if (phase >= config.sync_phase)
-	{
-		// wrap phase around
-		int const advance = FloorInt(phase / config.sync_phase);
-		phase -= advance * config.sync_phase;
-
-		// advance the wavetable index
-		int const cycle = config.cycle;
-		index += advance;
-		if (index >= cycle)
-			index -= cycle;
-	}
-	else if (phase < 0.0f)
-	{
-		// wrap phase around
-		int const advance = FloorInt(phase / config.sync_phase);
-		phase -= advance * config.sync_phase;
-
-		// rewind the wavetable index
-		int const cycle = config.cycle;
-		index += advance;
-		if (index < 0)
-			index += cycle;
-	}
-#endif
-}
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Oscillator
+*/
+#include "Platform.h"
+
+#include "Oscillator.h"
+#include "OscillatorKernel.h"
+#include "Wave.h"
+#include "Math.h"
+#include "Random.h"
+
+// reset oscillator
+void OscillatorState::Reset()
+{
+	phase = 0.0f;
+	index = 0;
+#if OSCILLATOR_PHASE != OSCILLATOR_PHASE_FLOAT
+	accumulator = 0;
+#endif
+	seed = Random::gSeed;
+	counter = 0;
+	memset(f, 0, sizeof(f));
+	blep.Reset();
+}
+
+// start oscillator
+void OscillatorState::Start()
+{
+//	Reset();
+	SetPhase(0.0f);
+	seed = Random::Int();
+	counter = 0;
+}
+
+// set the phase within the current cycle
+// (a phase past the end of the cycle advances the wavetable index
+// on the next step, or right away with a fixed-point phase)
+void OscillatorState::SetPhase(float const value)
+{
+#if OSCILLATOR_PHASE == OSCILLATOR_PHASE_FLOAT
+	phase = value;
+#else
+	unsigned long long const fixed = PhaseToFixed(value);
+#if OSCILLATOR_PHASE == OSCILLATOR_PHASE_FIXED32
+	accumulator = unsigned(fixed);
+	index += int(fixed >> 32);
+#else
+	accumulator = (accumulator & 0xFFFFFFFF00000000ULL) + fixed;
+#endif
+	Unpack();
+#endif
+}
+
+// update oscillator
+float OscillatorState::Update(OscillatorConfig const &config, float const step)
+{
+	float const delta = config.frequency * config.adjust * step;
+
+	// compute oscillator value
+	float const value = Compute(config, delta);
+
+	// advance oscillator phase
+	Advance(config, delta);
+
+	return value;
+}
+
+// load lane phases and compute phase steps
+void OscillatorGroup::Load(OscillatorConfig const &config, float const step[SIMD_WIDTH])
+{
+	SIMD_ALIGN float p[SIMD_WIDTH], d[SIMD_WIDTH], r[SIMD_WIDTH];
+	for (int lane = 0; lane < SIMD_WIDTH; ++lane)
+	{
+		p[lane] = state[lane]->phase;
+		d[lane] = config.frequency * config.adjust * step[lane];
+		r[lane] = config.frequency_step * config.adjust * step[lane];
+	}
+	phase = SIMDFloat::Load(p);
+	delta = SIMDFloat::Load(d);
+	delta_step = SIMDFloat::Load(r);
+	cycles = SIMDFloat(0.0f);
+#if OSCILLATOR_PHASE != OSCILLATOR_PHASE_FLOAT
+	for (int lane = 0; lane < SIMD_WIDTH; ++lane)
+	{
+		delta_fixed[lane] = PhaseToFixed(d[lane]);
+		delta_lane[lane] = d[lane];
+		delta_step_lane[lane] = r[lane];
+	}
+#endif
+}
+
+// store lane phases and advance the wavetable indices
+void OscillatorGroup::Store(OscillatorConfig const &config, size_t const count)
+{
+#if OSCILLATOR_PHASE == OSCILLATOR_PHASE_FLOAT
+	(void)count;	// the float phases are already current
+	SIMD_ALIGN float p[SIMD_WIDTH], c[SIMD_WIDTH];
+	phase.Store(p);
+	cycles.Store(c);
+	for (int lane = 0; lane < SIMD_WIDTH; ++lane)
+	{
+		OscillatorState &s = *state[lane];
+		s.phase = p[lane];
+		s.index += int(c[lane]);
+		if (s.index >= int(config.cycle))
+			s.index -= int(config.cycle);
+		else if (s.index < 0)
+			s.index += int(config.cycle);
+	}
+#else
+	// advance the accumulators by the whole block at once
+	// (the vector phases only track them approximately within the block;
+	// a ramping step sums the same fixed-point steps the scalar kernels take)
+	for (int lane = 0; lane < SIMD_WIDTH; ++lane)
+	{
+		unsigned long long advance = delta_fixed[lane] * count;
+		if (delta_step_lane[lane] != 0.0f)
+		{
+			advance = 0;
+			float d = delta_lane[lane];
+			for (size_t i = 0; i < count; ++i)
+			{
+				advance += PhaseToFixed(d);
+				d += delta_step_lane[lane];
+			}
+		}
+		state[lane]->AdvanceFixed<false>(config, advance, 0);
+	}
+#endif
+}
+
+// compute the oscillator value
+float OscillatorState::Compute(OscillatorConfig const &config, float delta)
+{
+	return config.amplitude * config.evaluate(config, *this, delta);
+}
+
+// advance the oscillator phase
+void OscillatorState::Advance(OscillatorConfig const &config, float delta)
+{
+	if (config.sync_enable)
+		Advance<true>(config, delta);
+	else
+		Advance<false>(config, delta);
+}
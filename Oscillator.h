@@ -1,85 +1,240 @@
-#pragma once
-/*
-MINI VIRTUAL ANALOG SYNTHESIZER
-Copyright 2014 Kenneth D. Miller III
-
-Oscillator
-*/
-
-#include "Wave.h"
-
-// base frequency oscillator configuration
-class OscillatorConfig
-{
-public:
-	bool enable;
-
-	Wave wavetype;
-	float waveparam;
-	float frequency;
-	float amplitude;
-
-	// hard sync
-	bool sync_enable;
-	float sync_phase;
-
-	// derived values
-	WaveEvaluate evaluate;
-	size_t cycle;
-	float adjust;
-
-	OscillatorConfig(bool const enable, Wave const wavetype, float const waveparam, float const frequency, float const amplitude)
-		: enable(enable)
-		, wavetype(wavetype)
-		, waveparam(waveparam)
-		, frequency(frequency)
-		, amplitude(amplitude)
-		, sync_enable(false)
-		, sync_phase(1.0f)
-	{
-		SetWaveType(wavetype);
-	}
-
-	void SetWaveType(Wave type)
-	{
-		wavetype = type;
-		evaluate = wave_evaluate[wavetype];
-		cycle = wave_loop_cycle[wavetype];
-		adjust = wave_adjust_frequency[wavetype];
-	}
-};
-
-// oscillator state
-class OscillatorState
-{
-public:
-	float phase;
-	int index;
-
-	// state values usable by wave functions
-	union
-	{
-		float f[8];
-		int i[8];
-	};
-
-	OscillatorState()
-	{
-		Reset();
-	}
-
-	// reset the oscillator
-	void Reset();
-
-	// start the oscillator
-	void Start();
-
-	// update the oscillator by one step
-	float Update(OscillatorConfig const &config, float const step);
-
-	// compute the oscillator value
-	float Compute(OscillatorConfig const &config, float delta);
-
-	// advance the oscillator phase
-	void Advance(OscillatorConfig const &config, float delta);
-};
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Oscillator
+*/
+
+#include "Wave.h"
+#include "SIMD.h"
+#include "MinBLEP.h"
+
+// oscillator phase accumulator
+// - float: float phase and integer wavetable index
+// - fixed32: 0.32 fixed-point phase; carries advance the wavetable index
+// - fixed64: 32.32 fixed-point position; the wavetable index is the high half
+// (fixed-point phases wrap exactly by integer overflow and keep full
+// precision on long notes; wave functions read the phase and index
+// the same way in every mode)
+#define OSCILLATOR_PHASE_FLOAT 0
+#define OSCILLATOR_PHASE_FIXED32 1
+#define OSCILLATOR_PHASE_FIXED64 2
+#define OSCILLATOR_PHASE OSCILLATOR_PHASE_FLOAT
+
+#if OSCILLATOR_PHASE == OSCILLATOR_PHASE_FIXED32
+typedef unsigned int OscillatorPhase;
+#elif OSCILLATOR_PHASE == OSCILLATOR_PHASE_FIXED64
+typedef unsigned long long OscillatorPhase;
+#endif
+
+#if OSCILLATOR_PHASE != OSCILLATOR_PHASE_FLOAT
+// convert a non-negative phase or phase step to 32.32 fixed point
+static inline unsigned long long PhaseToFixed(float const value)
+{
+	return (unsigned long long)(double(value) * 4294967296.0);
+}
+#endif
+
+class WavetableFile;
+
+// base frequency oscillator configuration
+class OscillatorConfig
+{
+public:
+	bool enable;
+
+	Wave wavetype;
+	float waveparam;
+	float frequency;
+	float amplitude;
+
+	// per-sample amplitude change
+	// (for ramping across a control update)
+	float amplitude_step;
+
+	// per-sample frequency and wave parameter changes
+	// (for ramping LFO modulation across a control update)
+	float frequency_step;
+	float waveparam_step;
+
+	// hard sync
+	bool sync_enable;
+	float sync_phase;
+
+	// loaded wavetable for the user wavetable wave
+	// (null if none; see LoadWavetable)
+	WavetableFile const *wavetable;
+
+	// derived values
+	WaveEvaluate evaluate;
+	size_t cycle;
+	float adjust;
+
+	OscillatorConfig(bool const enable, Wave const wavetype, float const waveparam, float const frequency, float const amplitude)
+		: enable(enable)
+		, wavetype(wavetype)
+		, waveparam(waveparam)
+		, frequency(frequency)
+		, amplitude(amplitude)
+		, amplitude_step(0.0f)
+		, frequency_step(0.0f)
+		, waveparam_step(0.0f)
+		, sync_enable(false)
+		, sync_phase(1.0f)
+		, wavetable(NULL)
+	{
+		SetWaveType(wavetype);
+	}
+
+	void SetWaveType(Wave type)
+	{
+		wavetype = type;
+		evaluate = wave_evaluate[wavetype];
+		cycle = wave_loop_cycle[wavetype];
+		adjust = wave_adjust_frequency[wavetype];
+	}
+};
+
+// oscillator state
+class OscillatorState
+{
+public:
+	float phase;
+	int index;
+
+#if OSCILLATOR_PHASE != OSCILLATOR_PHASE_FLOAT
+	// fixed-point phase accumulator
+	// (phase and index follow it; see Unpack)
+	OscillatorPhase accumulator;
+#endif
+
+	// random number generator state for noise waves
+	// (per oscillator so voices can render on any thread)
+	unsigned int seed;
+
+	// counter-based random stream position for the noise wave
+	// (the seed is its key; see Random::Counter)
+	unsigned int counter;
+
+	// state values usable by wave functions
+	union
+	{
+		float f[8];
+		int i[8];
+	};
+
+	// step residuals for MinBLEP antialiasing
+	MinBLEPBuffer blep;
+
+	OscillatorState()
+	{
+		Reset();
+	}
+
+	// reset the oscillator
+	void Reset();
+
+	// start the oscillator
+	void Start();
+
+	// set the phase within the current cycle
+	void SetPhase(float const value);
+
+	// update the oscillator by one step
+	float Update(OscillatorConfig const &config, float const step);
+
+	// compute the oscillator value
+	float Compute(OscillatorConfig const &config, float delta);
+
+	// advance the oscillator phase
+	void Advance(OscillatorConfig const &config, float delta);
+
+	// advance the oscillator phase with hard sync fixed at compile time
+	// (defined in OscillatorKernel.h)
+	template<bool SYNC> void Advance(OscillatorConfig const &config, float delta);
+
+#if OSCILLATOR_PHASE != OSCILLATOR_PHASE_FLOAT
+	// advance the fixed-point phase by a 32.32 step
+	// (sync is the 32.32 hard sync phase; defined in OscillatorKernel.h)
+	template<bool SYNC> void AdvanceFixed(OscillatorConfig const &config, unsigned long long const delta, unsigned long long const sync);
+
+	// update phase and index from the accumulator
+	void Unpack()
+	{
+#if OSCILLATOR_PHASE == OSCILLATOR_PHASE_FIXED32
+		phase = float(accumulator >> 8) * (1.0f / 16777216.0f);
+#else
+		phase = float(unsigned(accumulator) >> 8) * (1.0f / 16777216.0f);
+		index = int(accumulator >> 32);
+#endif
+	}
+#endif
+};
+
+// largest difference between a wave group function and the scalar
+// wave function for the same oscillator
+// (they match exactly unless the compiler contracts multiplies and adds
+// differently; the -bench report checks every group function against it)
+static float const OSCILLATOR_GROUP_TOLERANCE = 1e-6f;
+
+// group of oscillators updated together
+// (one oscillator per SIMD lane, all sharing the same configuration;
+// wave group functions evaluate every lane at once without branching
+// and match the scalar wave functions to OSCILLATOR_GROUP_TOLERANCE)
+class OscillatorGroup
+{
+public:
+	// oscillator state and output buffer for each lane
+	OscillatorState *state[SIMD_WIDTH];
+	float *buffer[SIMD_WIDTH];
+
+	// phase and phase step for each lane
+	SIMDFloat phase;
+	SIMDFloat delta;
+
+	// per-sample phase step change for each lane
+	// (from the frequency step; see OscillatorConfig)
+	SIMDFloat delta_step;
+
+	// phase cycles completed since Load
+	SIMDFloat cycles;
+
+#if OSCILLATOR_PHASE != OSCILLATOR_PHASE_FLOAT
+	// 32.32 fixed-point phase step for each lane
+	// (Store advances the accumulators exactly)
+	unsigned long long delta_fixed[SIMD_WIDTH];
+
+	// phase step and its per-sample change for each lane
+	// (Store repeats the scalar kernels' ramp when the step changes)
+	float delta_lane[SIMD_WIDTH];
+	float delta_step_lane[SIMD_WIDTH];
+#endif
+
+	// load lane phases and compute phase steps
+	void Load(OscillatorConfig const &config, float const step[SIMD_WIDTH]);
+
+	// store lane phases and advance the wavetable indices
+	// (after count steps)
+	void Store(OscillatorConfig const &config, size_t const count);
+
+	// accumulate output values
+	void Accumulate(size_t const i, SIMDFloat const value)
+	{
+		SIMD_ALIGN float v[SIMD_WIDTH];
+		value.Store(v);
+		for (int lane = 0; lane < SIMD_WIDTH; ++lane)
+			buffer[lane][i] += v[lane];
+	}
+
+	// advance the oscillator phases and ramp the phase steps
+	// (same as OscillatorState::Advance without hard sync)
+	void Advance()
+	{
+		phase = phase + delta;
+		SIMDFloat const advance = Floor(phase);
+		phase = phase - advance;
+		cycles = cycles + advance;
+		delta = delta + delta_step;
+	}
+};
@@ -0,0 +1,251 @@
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Oscillator Kernel
+*/
+
+#include "OscillatorNote.h"
+#include "SubOscillator.h"
+#include "Math.h"
+
+// advance the oscillator phase
+template<bool SYNC> inline void OscillatorState::Advance(OscillatorConfig const &config, float delta)
+{
+#if OSCILLATOR_PHASE != OSCILLATOR_PHASE_FLOAT
+	AdvanceFixed<SYNC>(config, PhaseToFixed(delta), SYNC ? PhaseToFixed(config.sync_phase) : 0);
+#elif 1
+	phase += delta;
+	int const advance = FloorInt(phase);
+	if (advance)
+	{
+		// wrap phase around
+		phase -= advance;
+
+		// advance the wavetable index
+		index += advance;
+		if (index >= int(config.cycle))
+			index -= int(config.cycle);
+		else if (index < 0)
+			index += int(config.cycle);
+	}
+	if (SYNC)
+	{
+		if (phase >= config.sync_phase - index)
+		{
+			phase -= config.sync_phase - index;
+			index = 0;
+		}
+	}
+#else
+	phase += delta;
+	if (phase >= config.sync_phase)
+	{
+		// wrap phase around
+		int const advance = FloorInt(phase / config.sync_phase);
+		phase -= advance * config.sync_phase;
+
+		// advance the wavetable index
+		int const cycle = config.cycle;
+		index += advance;
+		if (index >= cycle)
+			index -= cycle;
+	}
+	else if (phase < 0.0f)
+	{
+		// wrap phase around
+		int const advance = FloorInt(phase / config.sync_phase);
+		phase -= advance * config.sync_phase;
+
+		// rewind the wavetable index
+		int const cycle = config.cycle;
+		index += advance;
+		if (index < 0)
+			index += cycle;
+	}
+#endif
+}
+
+#if OSCILLATOR_PHASE == OSCILLATOR_PHASE_FIXED32
+// advance the fixed-point phase
+// (the phase wraps by overflow and the carry advances the wavetable index)
+template<bool SYNC> inline void OscillatorState::AdvanceFixed(OscillatorConfig const &config, unsigned long long const delta, unsigned long long const sync)
+{
+	unsigned int const prev = accumulator;
+	accumulator += unsigned(delta);
+	index += int(delta >> 32) + (accumulator < prev);
+	if (index >= int(config.cycle))
+		index -= int(config.cycle);
+	if (SYNC)
+	{
+		// position in the sync cycle
+		unsigned long long position = ((unsigned long long)(index) << 32) | accumulator;
+		if (position >= sync)
+		{
+			position -= sync;
+			accumulator = unsigned(position);
+			index = int(position >> 32);
+		}
+	}
+	Unpack();
+}
+#elif OSCILLATOR_PHASE == OSCILLATOR_PHASE_FIXED64
+// advance the fixed-point phase
+// (the phase wraps by overflow into the wavetable index)
+template<bool SYNC> inline void OscillatorState::AdvanceFixed(OscillatorConfig const &config, unsigned long long const delta, unsigned long long const sync)
+{
+	accumulator += delta;
+	if ((accumulator >> 32) >= config.cycle)
+		accumulator -= (unsigned long long)(config.cycle) << 32;
+	if (SYNC)
+	{
+		if (accumulator >= sync)
+			accumulator -= sync;
+	}
+	Unpack();
+}
+#endif
+
+// render one note oscillator for a block of steps
+// (accumulates into the output buffer; the wave function and feature
+// flags are template parameters so each combination compiles to its
+// own loop without per-sample indirect calls or flag tests; the phase
+// step and wave parameter ramp across the block like the amplitude)
+template<WaveEvaluate EVALUATE, bool SYNC, bool SUB> void OscillatorKernel(NoteOscillatorConfig const &config, OscillatorState &state, float step, float buffer[], size_t count)
+{
+	float delta = config.frequency * config.adjust * step;
+	float const delta_step = config.frequency_step * config.adjust * step;
+	float amplitude = config.amplitude;
+#if OSCILLATOR_PHASE != OSCILLATOR_PHASE_FLOAT
+	unsigned long long delta_fixed = PhaseToFixed(delta);
+	unsigned long long const sync_fixed = SYNC ? PhaseToFixed(config.sync_phase) : 0;
+#endif
+
+	// wave functions read the wave parameter from the configuration
+	NoteOscillatorConfig ramp(config);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		// accumulate sub-oscillator value
+		if (SUB)
+			buffer[i] += config.sub_osc_amplitude * SubOscillator(config, state, step);
+
+		// accumulate oscillator value
+		buffer[i] += amplitude * EVALUATE(ramp, state, delta);
+		amplitude += config.amplitude_step;
+
+		// advance oscillator phase
+#if OSCILLATOR_PHASE == OSCILLATOR_PHASE_FLOAT
+		state.Advance<SYNC>(config, delta);
+#else
+		state.AdvanceFixed<SYNC>(config, delta_fixed, sync_fixed);
+#endif
+
+		// ramp phase step and wave parameter
+		delta += delta_step;
+		ramp.waveparam += config.waveparam_step;
+#if OSCILLATOR_PHASE != OSCILLATOR_PHASE_FLOAT
+		if (delta_step != 0.0f)
+			delta_fixed = PhaseToFixed(delta);
+#endif
+	}
+}
+
+// oscillator kernels for a wave evaluator template
+// (evaluate<ANTIALIASED, SYNC>; the result initializes a wave render
+// table indexed by antialiasing, hard sync, and sub-oscillator)
+#define OSCILLATOR_KERNELS(evaluate) \
+{ \
+	{ \
+		{ OscillatorKernel<evaluate<false, false>, false, false>, OscillatorKernel<evaluate<false, false>, false, true> }, \
+		{ OscillatorKernel<evaluate<false, true>, true, false>, OscillatorKernel<evaluate<false, true>, true, true> }, \
+	}, \
+	{ \
+		{ OscillatorKernel<evaluate<true, false>, false, false>, OscillatorKernel<evaluate<true, false>, false, true> }, \
+		{ OscillatorKernel<evaluate<true, true>, true, false>, OscillatorKernel<evaluate<true, true>, true, true> }, \
+	}, \
+}
+
+// render one note oscillator with MinBLEP antialiasing for a block of steps
+// (EDGES gives the naive wave value at a phase and adds a step residual
+// for each discontinuity it crosses; hard sync adds one more step for
+// the jump back to the start of the wave)
+template<class EDGES, bool SYNC, bool SUB> void MinBLEPKernel(NoteOscillatorConfig const &config, OscillatorState &state, float step, float buffer[], size_t count)
+{
+	float delta = config.frequency * config.adjust * step;
+	float const delta_step = config.frequency_step * config.adjust * step;
+	float scale = 1.0f / delta;
+	NoteOscillatorConfig ramp(config);
+	EDGES edges(config);
+
+	// silent above the Nyquist frequency like the wave functions
+	// (for the highest pitch the block ramps to)
+	float const top = Max(delta, delta + delta_step * float(count));
+	float amplitude = top > 0.5f ? 0.0f : config.amplitude;
+	float const amplitude_step = top > 0.5f ? 0.0f : config.amplitude_step;
+#if OSCILLATOR_PHASE != OSCILLATOR_PHASE_FLOAT
+	unsigned long long delta_fixed = PhaseToFixed(delta);
+	unsigned long long const sync_fixed = SYNC ? PhaseToFixed(config.sync_phase) : 0;
+#endif
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		// accumulate sub-oscillator value
+		if (SUB)
+			buffer[i] += config.sub_osc_amplitude * SubOscillator(config, state, step);
+
+		// accumulate oscillator value
+		buffer[i] += amplitude * (edges.Value(state.phase) + state.blep.Pop());
+		amplitude += amplitude_step;
+
+		// add steps for discontinuities before the next step
+		// (positions count from the start of the sync cycle; each step
+		// happened (end - position) / delta steps before the next one)
+		float const from = SYNC ? state.phase + state.index : state.phase;
+		float const end = from + delta;
+		if (SYNC && end >= config.sync_phase)
+		{
+			float const sync_phase = config.sync_phase;
+			float const after = end - sync_phase;
+			edges.Add(state.blep, from, sync_phase, end, scale);
+			state.blep.Add(after * scale, edges.Value(0.0f) - edges.Value(sync_phase - FloorInt(sync_phase)));
+			edges.Add(state.blep, 0.0f, after, after, scale);
+		}
+		else
+		{
+			edges.Add(state.blep, from, end, end, scale);
+		}
+
+		// advance oscillator phase
+#if OSCILLATOR_PHASE == OSCILLATOR_PHASE_FLOAT
+		state.Advance<SYNC>(config, delta);
+#else
+		state.AdvanceFixed<SYNC>(config, delta_fixed, sync_fixed);
+#endif
+
+		// ramp phase step and wave parameter
+		if (delta_step != 0.0f)
+		{
+			delta += delta_step;
+			scale = 1.0f / delta;
+#if OSCILLATOR_PHASE != OSCILLATOR_PHASE_FLOAT
+			delta_fixed = PhaseToFixed(delta);
+#endif
+		}
+		if (config.waveparam_step != 0.0f)
+		{
+			ramp.waveparam += config.waveparam_step;
+			edges = EDGES(ramp);
+		}
+	}
+}
+
+// MinBLEP kernels for a wave edge class
+// (the result initializes a MinBLEP render table indexed by hard sync
+// and sub-oscillator)
+#define MINBLEP_KERNELS(edges) \
+{ \
+	{ MinBLEPKernel<edges, false, false>, MinBLEPKernel<edges, false, true> }, \
+	{ MinBLEPKernel<edges, true, false>, MinBLEPKernel<edges, true, true> }, \
+}
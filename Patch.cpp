@@ -0,0 +1,322 @@
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Patch Loading
+*/
+#include "Platform.h"
+
+#include "Patch.h"
+#include "Wave.h"
+#include "OscillatorLFO.h"
+#include "OscillatorNote.h"
+#include "SubOscillator.h"
+#include "Filter.h"
+#include "Amplifier.h"
+#include "Tuning.h"
+#include "Wavetable.h"
+
+// A patch is a text file with one "name = value" property per line.
+// Blank lines and text following '#' are ignored.  Property values use
+// the same units as the synthesizer configuration:
+// - frequencies and cutoffs are logarithmic (octaves)
+// - times are in seconds
+// - levels, widths, and key follow are fractions (1 = 100%)
+// - wave, sub-oscillator, filter mode, filter model, and antialiasing
+//   method values use their display names or their index in the
+//   corresponding list
+// - tuning is the name of a Scala scale file (.scl)
+// - wavetables are names of wave files (.wav) for the Wavetable wave;
+//   the wave parameter scans their frames
+//
+//     osc1.enable = 1
+//     osc1.wave = Sawtooth
+//     osc2.wave = Wavetable
+//     osc2.wavetable = formant.wav
+//     flt.enable = 1
+//     flt.mode = Low-Pass 4
+//     flt.model = TPT Moog
+//     flt.cutoff = 2.5
+//     amp.enable = 1
+//     amp.release = 0.5
+//     tuning = pythagorean.scl
+//     antialias.method = Wavetable
+
+// patch property value types
+enum PatchType
+{
+	PATCH_BOOL,
+	PATCH_FLOAT,
+	PATCH_WAVE,
+	PATCH_SUBOSC,
+	PATCH_FILTER_MODE,
+	PATCH_FILTER_MODEL,
+	PATCH_TUNING,
+	PATCH_WAVETABLE,
+	PATCH_ANTIALIAS_METHOD,
+};
+
+// patch property description
+struct PatchProperty
+{
+	char const *name;
+	PatchType type;
+	void *data;
+};
+
+// map property names to configuration values
+static PatchProperty const patch_property[] =
+{
+	{ "osc1.enable",			PATCH_BOOL,			&osc_config[0].enable },
+	{ "osc1.wave",				PATCH_WAVE,			&osc_config[0].wavetype },
+	{ "osc1.waveparam",			PATCH_FLOAT,		&osc_config[0].waveparam_base },
+	{ "osc1.frequency",			PATCH_FLOAT,		&osc_config[0].frequency_base },
+	{ "osc1.amplitude",			PATCH_FLOAT,		&osc_config[0].amplitude_base },
+	{ "osc1.waveparam_lfo",		PATCH_FLOAT,		&osc_config[0].waveparam_lfo },
+	{ "osc1.frequency_lfo",		PATCH_FLOAT,		&osc_config[0].frequency_lfo },
+	{ "osc1.amplitude_lfo",		PATCH_FLOAT,		&osc_config[0].amplitude_lfo },
+	{ "osc1.key_follow",		PATCH_FLOAT,		&osc_config[0].key_follow },
+	{ "osc1.sub_osc_mode",		PATCH_SUBOSC,		&osc_config[0].sub_osc_mode },
+	{ "osc1.sub_osc_amplitude",	PATCH_FLOAT,		&osc_config[0].sub_osc_amplitude },
+	{ "osc1.sync",				PATCH_BOOL,			&osc_config[0].sync_enable },
+	{ "osc1.wavetable",			PATCH_WAVETABLE,	&osc_config[0].wavetable },
+
+	{ "osc2.enable",			PATCH_BOOL,			&osc_config[1].enable },
+	{ "osc2.wave",				PATCH_WAVE,			&osc_config[1].wavetype },
+	{ "osc2.waveparam",			PATCH_FLOAT,		&osc_config[1].waveparam_base },
+	{ "osc2.frequency",			PATCH_FLOAT,		&osc_config[1].frequency_base },
+	{ "osc2.amplitude",			PATCH_FLOAT,		&osc_config[1].amplitude_base },
+	{ "osc2.waveparam_lfo",		PATCH_FLOAT,		&osc_config[1].waveparam_lfo },
+	{ "osc2.frequency_lfo",		PATCH_FLOAT,		&osc_config[1].frequency_lfo },
+	{ "osc2.amplitude_lfo",		PATCH_FLOAT,		&osc_config[1].amplitude_lfo },
+	{ "osc2.key_follow",		PATCH_FLOAT,		&osc_config[1].key_follow },
+	{ "osc2.sub_osc_mode",		PATCH_SUBOSC,		&osc_config[1].sub_osc_mode },
+	{ "osc2.sub_osc_amplitude",	PATCH_FLOAT,		&osc_config[1].sub_osc_amplitude },
+	{ "osc2.sync",				PATCH_BOOL,			&osc_config[1].sync_enable },
+	{ "osc2.wavetable",			PATCH_WAVETABLE,	&osc_config[1].wavetable },
+
+	{ "lfo.enable",				PATCH_BOOL,			&lfo_config.enable },
+	{ "lfo.wave",				PATCH_WAVE,			&lfo_config.wavetype },
+	{ "lfo.waveparam",			PATCH_FLOAT,		&lfo_config.waveparam },
+	{ "lfo.frequency",			PATCH_FLOAT,		&lfo_config.frequency_base },
+	{ "lfo.wavetable",			PATCH_WAVETABLE,	&lfo_config.wavetable },
+
+	{ "flt.enable",				PATCH_BOOL,			&flt_config.enable },
+	{ "flt.mode",				PATCH_FILTER_MODE,	&flt_config.mode },
+	{ "flt.model",				PATCH_FILTER_MODEL,	&flt_config.model },
+	{ "flt.drive",				PATCH_FLOAT,		&flt_config.drive },
+	{ "flt.resonance",			PATCH_FLOAT,		&flt_config.resonance },
+	{ "flt.cutoff",				PATCH_FLOAT,		&flt_config.cutoff_base },
+	{ "flt.cutoff_lfo",			PATCH_FLOAT,		&flt_config.cutoff_lfo },
+	{ "flt.cutoff_env",			PATCH_FLOAT,		&flt_config.cutoff_env },
+	{ "flt.cutoff_env_vel",		PATCH_FLOAT,		&flt_config.cutoff_env_vel },
+	{ "flt.key_follow",			PATCH_FLOAT,		&flt_config.key_follow },
+	{ "flt.attack",				PATCH_FLOAT,		&flt_env_config.attack_time },
+	{ "flt.decay",				PATCH_FLOAT,		&flt_env_config.decay_time },
+	{ "flt.sustain",			PATCH_FLOAT,		&flt_env_config.sustain_level },
+	{ "flt.release",			PATCH_FLOAT,		&flt_env_config.release_time },
+
+	{ "amp.enable",				PATCH_BOOL,			&amp_env_config.enable },
+	{ "amp.level_env",			PATCH_FLOAT,		&amp_config.level_env },
+	{ "amp.level_env_vel",		PATCH_FLOAT,		&amp_config.level_env_vel },
+	{ "amp.attack",				PATCH_FLOAT,		&amp_env_config.attack_time },
+	{ "amp.decay",				PATCH_FLOAT,		&amp_env_config.decay_time },
+	{ "amp.sustain",			PATCH_FLOAT,		&amp_env_config.sustain_level },
+	{ "amp.release",			PATCH_FLOAT,		&amp_env_config.release_time },
+
+	{ "tuning",					PATCH_TUNING,		NULL },
+
+	{ "antialias",				PATCH_BOOL,			&use_antialias },
+	{ "antialias.method",		PATCH_ANTIALIAS_METHOD,	&antialias_method },
+};
+
+// case-insensitive name comparison
+static bool NameEquals(char const *a, char const *b)
+{
+	while (tolower((unsigned char)*a) == tolower((unsigned char)*b))
+	{
+		if (*a == '\0')
+			return true;
+		++a, ++b;
+	}
+	return false;
+}
+
+// find a name or index in a list of display names
+// (returns -1 if not found)
+static int FindName(char const *value, char const * const names[], int count)
+{
+	if (isdigit((unsigned char)value[0]))
+	{
+		int const index = atoi(value);
+		return index < count ? index : -1;
+	}
+	for (int i = 0; i < count; ++i)
+	{
+		if (NameEquals(value, names[i]))
+			return i;
+	}
+	return -1;
+}
+
+// remove leading and trailing whitespace
+static char *Trim(char *text)
+{
+	while (isspace((unsigned char)*text))
+		++text;
+	char *end = text + strlen(text);
+	while (end > text && isspace((unsigned char)end[-1]))
+		--end;
+	*end = '\0';
+	return text;
+}
+
+// set a property from its text value
+static bool SetProperty(PatchProperty const &property, char const *value)
+{
+	switch (property.type)
+	{
+	case PATCH_BOOL:
+		*static_cast<bool *>(property.data) = atoi(value) != 0;
+		return true;
+	case PATCH_FLOAT:
+		*static_cast<float *>(property.data) = float(atof(value));
+		return true;
+	case PATCH_WAVE:
+		{
+			int const index = FindName(value, wave_name, WAVE_COUNT);
+			if (index < 0)
+				return false;
+			*static_cast<Wave *>(property.data) = Wave(index);
+			return true;
+		}
+	case PATCH_SUBOSC:
+		{
+			int const index = FindName(value, sub_osc_name, SUBOSC_COUNT);
+			if (index < 0)
+				return false;
+			*static_cast<SubOscillatorMode *>(property.data) = SubOscillatorMode(index);
+			return true;
+		}
+	case PATCH_FILTER_MODE:
+		{
+			int const index = FindName(value, filter_name, FilterConfig::COUNT);
+			if (index < 0)
+				return false;
+			*static_cast<FilterConfig::Mode *>(property.data) = FilterConfig::Mode(index);
+			return true;
+		}
+	case PATCH_FILTER_MODEL:
+		{
+			int const index = FindName(value, filter_model_name, FILTER_MODEL_COUNT);
+			if (index < 0)
+				return false;
+			*static_cast<int *>(property.data) = index;
+			return true;
+		}
+	case PATCH_TUNING:
+		return LoadTuning(value);
+	case PATCH_WAVETABLE:
+		{
+			WavetableFile const *table = LoadWavetable(value);
+			if (!table)
+				return false;
+			*static_cast<WavetableFile const **>(property.data) = table;
+			return true;
+		}
+	case PATCH_ANTIALIAS_METHOD:
+		{
+			int const index = FindName(value, antialias_method_name, ANTIALIAS_METHOD_COUNT);
+			if (index < 0)
+				return false;
+			*static_cast<AntialiasMethod *>(property.data) = AntialiasMethod(index);
+			return true;
+		}
+	}
+	return false;
+}
+
+// update values derived from loaded properties
+// (the same values the menus update when a property changes)
+static void UpdateDerived()
+{
+	for (int o = 0; o < NUM_OSCILLATORS; ++o)
+	{
+		osc_config[o].SetWaveType(osc_config[o].wavetype);
+		osc_config[o].sync_phase = 1.0f;
+		osc_config[o].Modulate(0.0f);
+	}
+
+	lfo_config.SetWaveType(lfo_config.wavetype);
+	lfo_config.frequency = powf(2.0f, lfo_config.frequency_base);
+
+	flt_config.SetMode(flt_config.mode);
+	flt_env_config.enable = flt_config.enable;
+	flt_env_config.attack_rate = 1.0f / (flt_env_config.attack_time + FLT_MIN);
+	flt_env_config.decay_rate = 1.0f / (flt_env_config.decay_time + FLT_MIN);
+	flt_env_config.release_rate = 1.0f / (flt_env_config.release_time + FLT_MIN);
+
+	amp_env_config.attack_rate = 1.0f / (amp_env_config.attack_time + FLT_MIN);
+	amp_env_config.decay_rate = 1.0f / (amp_env_config.decay_time + FLT_MIN);
+	amp_env_config.release_rate = 1.0f / (amp_env_config.release_time + FLT_MIN);
+}
+
+// load synthesizer settings from a patch file
+bool LoadPatch(char const *filename)
+{
+	FILE *file = fopen(filename, "r");
+	if (!file)
+	{
+		fprintf(stderr, "Can't open patch \"%s\"\n", filename);
+		return false;
+	}
+
+	char line[256];
+	int line_number = 0;
+	while (fgets(line, sizeof(line), file))
+	{
+		++line_number;
+
+		// strip comment
+		if (char *comment = strchr(line, '#'))
+			*comment = '\0';
+
+		// skip blank lines
+		char *name = Trim(line);
+		if (*name == '\0')
+			continue;
+
+		// split name and value
+		char *separator = strchr(name, '=');
+		if (!separator)
+		{
+			fprintf(stderr, "%s(%d): expected name = value\n", filename, line_number);
+			continue;
+		}
+		*separator = '\0';
+		name = Trim(name);
+		char const *value = Trim(separator + 1);
+
+		// find the property
+		size_t p = 0;
+		while (p < ARRAY_SIZE(patch_property) && !NameEquals(name, patch_property[p].name))
+			++p;
+		if (p == ARRAY_SIZE(patch_property))
+		{
+			fprintf(stderr, "%s(%d): unknown property \"%s\"\n", filename, line_number, name);
+			continue;
+		}
+
+		// set the property value
+		if (!SetProperty(patch_property[p], value))
+		{
+			fprintf(stderr, "%s(%d): invalid value \"%s\" for %s\n", filename, line_number, value, patch_property[p].name);
+		}
+	}
+
+	fclose(file);
+
+	UpdateDerived();
+
+	return true;
+}
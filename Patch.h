@@ -0,0 +1,11 @@
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Patch Loading
+*/
+
+// load synthesizer settings from a patch file
+// (returns false if the file could not be read)
+extern bool LoadPatch(char const *filename);
@@ -0,0 +1,84 @@
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Platform Support
+(portable includes for code that does not depend on Windows or BASS)
+*/
+
+// common includes
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <float.h>
+#include <limits.h>
+#include <assert.h>
+
+#if defined(_M_X64) || _M_IX86_FP > 0 || defined(__SSE__)
+#include <xmmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#define ARRAY_SIZE(x) (sizeof(x)/sizeof(x[0]))
+
+#ifndef _MSC_VER
+// compiler-specific keywords
+#define __forceinline inline __attribute__((always_inline))
+#define __assume(x) do { if (!(x)) __builtin_unreachable(); } while (0)
+#endif
+
+// flush denormals to zero
+// (returns the previous state for RestoreDenormals)
+static inline unsigned int FlushDenormals()
+{
+#if defined(_MSC_VER)
+	unsigned int prev;
+	_controlfp_s(&prev, _DN_FLUSH, _MCW_DN);
+	return prev;
+#elif defined(__SSE__)
+	// set flush-to-zero and denormals-are-zero
+	unsigned int const prev = _mm_getcsr();
+	_mm_setcsr(prev | 0x8040);
+	return prev;
+#else
+	return 0;
+#endif
+}
+
+// restore denormal handling
+static inline void RestoreDenormals(unsigned int prev)
+{
+#if defined(_MSC_VER)
+	_controlfp_s(&prev, prev, _MCW_DN);
+#elif defined(__SSE__)
+	_mm_setcsr(prev);
+#else
+	(void)prev;
+#endif
+}
+
+// index of the lowest set bit
+// (mask must not be zero)
+static inline int LowestBit(unsigned long long mask)
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+	unsigned long index;
+	_BitScanForward64(&index, mask);
+	return int(index);
+#elif defined(_MSC_VER)
+	unsigned long index;
+	if (_BitScanForward(&index, (unsigned long)mask))
+		return int(index);
+	_BitScanForward(&index, (unsigned long)(mask >> 32));
+	return int(index) + 32;
+#else
+	return __builtin_ctzll(mask);
+#endif
+}
@@ -1,15 +1,15 @@
-/*
-MINI VIRTUAL ANALOG SYNTHESIZER
-Copyright 2014 Kenneth D. Miller III
-
-Random Number Generator
-*/
-#include "StdAfx.h"
-
-#include "Random.h"
-
-namespace Random
-{
-	// random seed
-	unsigned int gSeed = 0x92D68CA2;
-}
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Random Number Generator
+*/
+#include "Platform.h"
+
+#include "Random.h"
+
+namespace Random
+{
+	// random seed
+	unsigned int gSeed = 0x92D68CA2;
+}
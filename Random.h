@@ -1,43 +1,95 @@
-#pragma once
-/*
-MINI VIRTUAL ANALOG SYNTHESIZER
-Copyright 2014 Kenneth D. Miller III
-
-Random Number Generator
-*/
-
-namespace Random
-{
-	// random seed
-	extern unsigned int gSeed;
-
-	// set seed
-	inline void Seed(unsigned int aSeed)
-	{
-		gSeed = aSeed;
-	}
-
-	// random unsigned integer
-	inline unsigned int Int()
-	{
-#if 1
-		// 32-bit xor-shift generator
-		// based on an implementation presented in a paper by George Marsaglia:
-		// http://www.jstatsoft.org/v08/i14/paper
-		gSeed ^= (gSeed << 13);
-		gSeed ^= (gSeed >> 17);
-		gSeed ^= (gSeed << 5);
-#else
-		gSeed = 1664525L * gSeed + 1013904223L;
-#endif
-		return gSeed;
-	}
-
-	// random uniform float
-	inline float Float()
-	{
-		union { float f; unsigned u; } floatint;
-		floatint.u = 0x3f800000 | (Int() >> 9);
-		return floatint.f - 1.0f;
-	}
-}
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Random Number Generator
+*/
+
+namespace Random
+{
+	// random seed
+	extern unsigned int gSeed;
+
+	// set seed
+	inline void Seed(unsigned int aSeed)
+	{
+		gSeed = aSeed;
+	}
+
+	// random unsigned integer from the given seed
+	inline unsigned int Int(unsigned int &aSeed)
+	{
+#if 1
+		// 32-bit xor-shift generator
+		// based on an implementation presented in a paper by George Marsaglia:
+		// http://www.jstatsoft.org/v08/i14/paper
+		aSeed ^= (aSeed << 13);
+		aSeed ^= (aSeed >> 17);
+		aSeed ^= (aSeed << 5);
+#else
+		aSeed = 1664525L * aSeed + 1013904223L;
+#endif
+		return aSeed;
+	}
+
+	// uniform float from random bits
+	inline float Unit(unsigned int aBits)
+	{
+		union { float f; unsigned u; } floatint;
+		floatint.u = 0x3f800000 | (aBits >> 9);
+		return floatint.f - 1.0f;
+	}
+
+	// random uniform float from the given seed
+	inline float Float(unsigned int &aSeed)
+	{
+		return Unit(Int(aSeed));
+	}
+
+	// rounds of the counter-based generator
+	// (the fewest that pass the BigCrush tests)
+	static int const COUNTER_ROUNDS = 13;
+
+	// random unsigned integer from a key and a counter
+	// - Threefry-2x32 (Salmon et al., "Parallel Random Numbers: As Easy
+	//   as 1, 2, 3") with the high key and counter words zero
+	// - each key is an independent stream, and each value depends only
+	//   on its counter, so streams can be generated in any order or
+	//   several at a time
+	// (T is unsigned int, or SIMDInt for one stream per lane)
+	template<typename T> inline T Counter(T const aKey, T const aCounter)
+	{
+		static int const rotate[8] = { 13, 15, 26, 6, 17, 29, 16, 24 };
+		T const key[3] = { aKey, T(0U), aKey ^ T(0x1BD11BDAU) };
+		T x0 = aCounter + key[0];
+		T x1 = key[1];
+		for (int r = 0; r < COUNTER_ROUNDS; ++r)
+		{
+			x0 = x0 + x1;
+			x1 = (x1 << rotate[r & 7]) | (x1 >> (32 - rotate[r & 7]));
+			x1 = x1 ^ x0;
+
+			// inject the key every four rounds
+			if ((r & 3) == 3)
+			{
+				int const i = (r >> 2) + 1;
+				x0 = x0 + key[i % 3];
+				x1 = x1 + key[(i + 1) % 3] + T(unsigned(i));
+			}
+		}
+		return x0;
+	}
+
+	// random unsigned integer
+	inline unsigned int Int()
+	{
+		return Int(gSeed);
+	}
+
+	// random uniform float
+	inline float Float()
+	{
+		return Float(gSeed);
+	}
+}
@@ -0,0 +1,584 @@
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Audio Rendering
+*/
+#include "Platform.h"
+
+#include "Render.h"
+#include "Math.h"
+#include "Voice.h"
+#include "OscillatorLFO.h"
+#include "OscillatorNote.h"
+#include "Filter.h"
+#include "Amplifier.h"
+#include "WorkerPool.h"
+#include "EventQueue.h"
+#include "Control.h"
+#include "Tuning.h"
+
+// output sample rate
+unsigned int render_frequency = 48000;
+
+// output scale factor
+float output_scale = 0.25f;	// 0.25f;
+
+// render sample clock
+// (samples rendered since startup)
+static unsigned long long render_clock;
+
+// samples per control update
+// (set by SetControlSamples)
+size_t render_control_samples = 16;
+
+// maximum samples per voice rendering block
+// (each block is a whole number of control updates)
+static size_t const RENDER_BLOCK_SAMPLES = CONTROL_SAMPLES_MAX;
+static size_t const RENDER_BLOCK_UPDATES = RENDER_BLOCK_SAMPLES / CONTROL_SAMPLES_MIN;
+
+// samples per voice rendering block for the current control rate
+static size_t render_block_samples = RENDER_BLOCK_SAMPLES / 16 * 16;
+
+// set the number of samples per control update
+void SetControlSamples(int samples)
+{
+	render_control_samples = size_t(Clamp(samples, CONTROL_SAMPLES_MIN, CONTROL_SAMPLES_MAX));
+	render_block_samples = RENDER_BLOCK_SAMPLES / render_control_samples * render_control_samples;
+}
+
+// control values for one control update
+// (shared by all voices in a rendering block; oscillator amplitudes,
+// frequencies, and wave parameters ramp across the update by their
+// per-sample steps, so LFO modulation does not step at coarse control rates)
+struct ControlBlock
+{
+	float step;
+	float lfo;
+	NoteOscillatorConfig osc[NUM_OSCILLATORS];
+};
+static ControlBlock control_block[RENDER_BLOCK_UPDATES];
+
+// apply low-frequency oscillator value
+static void ApplyLFO(float lfo)
+{
+	// compute shared oscillator values
+	for (int o = 0; o < NUM_OSCILLATORS; ++o)
+	{
+		osc_config[o].Modulate(lfo);
+	}
+
+	// set up sync phases
+	for (int o = 1; o < NUM_OSCILLATORS; ++o)
+	{
+		if (osc_config[o].sync_enable)
+			osc_config[o].sync_phase = osc_config[o].frequency / osc_config[0].frequency;
+	}
+}
+
+// per-voice buffers for the current rendering block
+static float voice_amp_env[VOICES_MAX][RENDER_BLOCK_SAMPLES];
+static float voice_output[VOICES_MAX][RENDER_BLOCK_SAMPLES];
+static size_t voice_live[VOICES_MAX];
+
+// number of filter banks
+static int const FILTER_BANKS = (VOICES_MAX + FILTER_LANES - 1) / FILTER_LANES;
+
+// active voices in each filter bank for the current rendering block
+// (each bank renders as one job on the worker pool)
+static int bank_index[FILTER_BANKS][FILTER_LANES];
+static int bank_active[FILTER_BANKS];
+static float bank_mix[FILTER_BANKS][RENDER_BLOCK_SAMPLES];
+static bool voice_finished[VOICES_MAX];
+
+// filter banks with active voices
+static int render_bank[FILTER_BANKS];
+static int render_banks;
+
+// values shared by the rendering jobs
+struct RenderJob
+{
+	size_t count;
+	float step;
+	float (*osc_key_freq)[NUM_OSCILLATORS];
+	float *flt_key_freq;
+};
+
+// render the volume envelope of one voice for a block of samples
+// (returns false if the voice finished)
+static bool RenderVoiceEnvelope(int const v, size_t const count, float const step)
+{
+	// update volume envelope generator
+	// (the voice stops contributing at the sample where it finishes)
+	size_t const live = amp_env_state[v].Render(amp_env_config, step, voice_amp_env[v], count);
+	voice_live[v] = live;
+
+	// clear oscillator output
+	memset(voice_output[v], 0, count * sizeof(voice_output[v][0]));
+
+	return live == count;
+}
+
+// render one oscillator of one voice for part of a control update
+// (the kernel comes from RenderOscillator, chosen once per update)
+static void RenderVoiceOscillator(int const v, int const o, NoteOscillatorConfig const &config, WaveRender const render, float const key_step, size_t const start, size_t const end)
+{
+	render(config, osc_state[v][o], key_step, voice_output[v] + start, end - start);
+}
+
+// render one oscillator of the active voices in a filter bank for a block of samples
+// (voices live for a whole control update go through the wave group
+// function SIMD_WIDTH at a time where the wave type has one)
+static void RenderOscillator(int const b, int const o, int const index[], int const active, float const osc_key_freq[][NUM_OSCILLATORS], size_t const count, float const step)
+{
+	// placeholder for unused lanes
+	// (one per filter bank since banks render in parallel)
+	static OscillatorState spare_state[FILTER_BANKS][SIMD_WIDTH];
+	static float spare_buffer[FILTER_BANKS][CONTROL_SAMPLES_MAX];
+
+	// assume key follow
+	float key_step[FILTER_LANES];
+	size_t live = 0;
+	for (int i = 0; i < active; ++i)
+	{
+		int const v = index[i];
+		key_step[i] = osc_key_freq[v][o] * step;
+		live = Max(live, voice_live[v]);
+	}
+
+	size_t const control = render_control_samples;
+	for (size_t start = 0; start < live; start += control)
+	{
+		NoteOscillatorConfig const &config = control_block[start / control].osc[o];
+		if (!config.enable)
+			continue;
+		size_t const end = Min(start + control, count);
+
+		// oscillator kernel for the wave type and feature flags
+		bool const antialias = use_antialias;
+		bool const sub_osc = config.sub_osc_mode && config.sub_osc_amplitude;
+		WaveRender render = wave_render[config.wavetype][antialias][config.sync_enable][sub_osc];
+
+		// wave group function, if usable
+		WaveRenderGroup render_group = (config.sync_enable || sub_osc || !wave_render_group[config.wavetype]) ? NULL : wave_render_group[config.wavetype][antialias];
+
+		// wavetable kernel instead, if chosen and usable
+		if (antialias && antialias_method == ANTIALIAS_METHOD_WAVETABLE && !config.sync_enable && wave_table_render[config.wavetype])
+		{
+			render = wave_table_render[config.wavetype][sub_osc];
+			render_group = NULL;
+		}
+
+		// MinBLEP kernel instead, if chosen and usable
+		if (antialias && antialias_method == ANTIALIAS_METHOD_MINBLEP && wave_minblep_render[config.wavetype])
+		{
+			render = wave_minblep_render[config.wavetype][config.sync_enable][sub_osc];
+			render_group = NULL;
+		}
+
+		OscillatorGroup group;
+		float group_step[SIMD_WIDTH];
+		int lanes = 0;
+		for (int i = 0; i < active; ++i)
+		{
+			int const v = index[i];
+			if (voice_live[v] <= start)
+				continue;
+
+			// render voices that finish partway through on their own
+			if (!render_group || voice_live[v] < end)
+			{
+				RenderVoiceOscillator(v, o, config, render, key_step[i], start, Min(end, voice_live[v]));
+				continue;
+			}
+
+			// add the voice to the group
+			group.state[lanes] = &osc_state[v][o];
+			group.buffer[lanes] = voice_output[v] + start;
+			group_step[lanes] = key_step[i];
+			++lanes;
+
+			// if the group is full...
+			if (lanes == SIMD_WIDTH)
+			{
+				group.Load(config, group_step);
+				render_group(config, group, end - start);
+				group.Store(config, end - start);
+				lanes = 0;
+			}
+		}
+
+		// render any partial group
+		if (lanes > 0)
+		{
+			for (int lane = lanes; lane < SIMD_WIDTH; ++lane)
+			{
+				group.state[lane] = &spare_state[b][lane];
+				group.buffer[lane] = spare_buffer[b];
+				group_step[lane] = group_step[0];
+			}
+			group.Load(config, group_step);
+			render_group(config, group, end - start);
+			group.Store(config, end - start);
+		}
+	}
+}
+
+// filter the active voices in a filter bank for a block of samples
+// (the bank updates FILTER_LANES voices at once)
+static void RenderFilterBank(int const b, int const index[], int const active, float const flt_key_freq[], size_t const count, float const step)
+{
+	// assign active voices to filter bank lanes
+	float *lane_buffer[FILTER_LANES] = {};
+	size_t live = 0;
+	for (int i = 0; i < active; ++i)
+	{
+		int const v = index[i];
+		lane_buffer[v % FILTER_LANES] = voice_output[v];
+		live = Max(live, voice_live[v]);
+	}
+
+	size_t const control = render_control_samples;
+	for (size_t start = 0; start < live; start += control)
+	{
+		size_t const u = start / control;
+		size_t const end = Min(start + control, count);
+
+		// get the modulated cutoff for each live voice
+		float *buffer[FILTER_LANES];
+		bool setup[FILTER_LANES];
+		SIMD_ALIGN float octaves[FILTER_LANES];
+		for (int lane = 0; lane < FILTER_LANES; ++lane)
+		{
+			buffer[lane] = lane_buffer[lane] ? lane_buffer[lane] + start : NULL;
+			octaves[lane] = 0.0f;
+
+			int const v = b * FILTER_LANES + lane;
+			setup[lane] = lane_buffer[lane] && start < voice_live[v];
+			if (!setup[lane])
+				continue;
+
+			// key velocity
+			float const key_vel = voice_vel[v] / 64.0f;
+
+			// update filter envelope generator
+			float const flt_env_amplitude = flt_env_state[v].Advance(flt_env_config, step, end - start);
+
+			// modulated cutoff in octaves
+			octaves[lane] = flt_config.GetCutoffOctaves(control_block[u].lfo, flt_env_amplitude, key_vel);
+		}
+
+		// convert cutoffs for all lanes at once
+		SIMD_ALIGN float cutoff[FILTER_LANES];
+		FastExp2(SIMDFloat::Load(octaves)).Store(cutoff);
+
+		// set up the filter for each live voice
+		for (int lane = 0; lane < FILTER_LANES; ++lane)
+		{
+			if (!setup[lane])
+				continue;
+
+			// set up the filter to ramp to the new cutoff across the update
+			int const v = b * FILTER_LANES + lane;
+			flt_bank[b].Setup(lane, flt_config.model, flt_key_freq[v] * cutoff[lane], flt_config.resonance, step, end - start);
+		}
+
+		// get filtered oscillator values
+		flt_bank[b].Render(flt_config, buffer, end - start);
+	}
+}
+
+// render the active voices in a filter bank for a block of samples
+// (runs on the worker pool; touches only the voices in the bank)
+static void RenderBank(int const job, void *context)
+{
+	RenderJob const &params = *static_cast<RenderJob const *>(context);
+	int const b = render_bank[job];
+	int const * const index = bank_index[b];
+	int const active = bank_active[b];
+
+	// render volume envelopes
+	for (int i = 0; i < active; ++i)
+	{
+		int const v = index[i];
+		voice_finished[v] = !RenderVoiceEnvelope(v, params.count, params.step);
+	}
+
+	// render oscillators
+	for (int o = 0; o < NUM_OSCILLATORS; ++o)
+		RenderOscillator(b, o, index, active, params.osc_key_freq, params.count, params.step);
+
+	// update filters
+	if (flt_config.enable)
+		RenderFilterBank(b, index, active, params.flt_key_freq, params.count, params.step);
+
+	// accumulated sample values
+	float * const mix = bank_mix[b];
+	memset(mix, 0, params.count * sizeof(mix[0]));
+
+	// for each active voice...
+	for (int i = 0; i < active; ++i)
+	{
+		// get the voice index
+		int const v = index[i];
+
+		// apply amplifier level and accumulate result
+		float const key_vel = voice_vel[v] / 64.0f;
+		float const * const amp_env = voice_amp_env[v];
+		float const * const osc_value = voice_output[v];
+		for (size_t c = 0; c < voice_live[v]; ++c)
+		{
+			mix[c] += osc_value[c] * amp_config.GetLevel(amp_env[c], key_vel);
+		}
+	}
+}
+
+// render stereo interleaved output samples between events
+static void RenderSegment(float buffer[], size_t count)
+{
+	// active voices
+	// (finished voices leave the list after each rendering block)
+	int const * const index = voice_active;
+
+	// key frequencies
+	static float osc_key_freq[VOICES_MAX][NUM_OSCILLATORS];
+	static float flt_key_freq[VOICES_MAX];
+
+	// key follow tables
+	// (rebuilt only when a key follow amount or the tuning changes)
+	static KeyFollowTable osc_key_follow[NUM_OSCILLATORS];
+	static KeyFollowTable flt_key_follow;
+	for (int o = 0; o < NUM_OSCILLATORS; ++o)
+		osc_key_follow[o].Update(osc_config[o].key_follow, Control::pitch_offset);
+	flt_key_follow.Update(flt_config.key_follow, Control::pitch_offset);
+
+	// wave tables in use
+	// (built on first use, so a render only pays for the waves it plays)
+	for (int o = 0; o < NUM_OSCILLATORS; ++o)
+		InitWaveType(osc_config[o].wavetype);
+	InitWaveType(lfo_config.wavetype);
+	if (use_antialias)
+		InitAntialiasMethod(antialias_method);
+
+	// for each active voice...
+	for (int i = 0; i < voice_active_count; ++i)
+	{
+		// get the voice index
+		int const v = index[i];
+
+		// compute oscillator key frequency
+		for (int o = 0; o < NUM_OSCILLATORS; ++o)
+		{
+			osc_key_freq[v][o] = osc_key_follow[o].Get(voice_note[v]);
+		}
+
+		// compute filter key frequency
+		flt_key_freq[v] = flt_key_follow.Get(voice_note[v]);
+	}
+
+	// low-frequency oscillator value
+	// (updated every render_control_samples)
+	float lfo = 0;
+
+	// if there are no active voices...
+	if (voice_active_count == 0)
+	{
+		// clear buffer
+		memset(buffer, 0, count * 2 * sizeof(buffer[0]));
+
+		// get low-frequency oscillator value
+		if (lfo_config.enable)
+			lfo = lfo_state.Update(lfo_config, float(count) / render_frequency);
+
+		// apply low-frequency oscillator
+		ApplyLFO(lfo);
+
+		return;
+	}
+
+	// flush denormals
+	unsigned int const prev = FlushDenormals();
+
+	// time step per output sample
+	float const step = 1.0f / render_frequency;
+
+	// if the low-frequency oscillator is off...
+	if (!lfo_config.enable)
+	{
+		ApplyLFO(0);
+	}
+
+	// for each rendering block...
+	size_t const control = render_control_samples;
+	for (size_t offset = 0; offset < count; offset += render_block_samples)
+	{
+		size_t const length = Min(count - offset, render_block_samples);
+		size_t const updates = (length + control - 1) / control;
+
+		// for each control update...
+		for (size_t u = 0; u < updates; ++u)
+		{
+			// samples and time step for the control update
+			// (the last one may be short when the segment ends at an event)
+			size_t const samples = Min(length - u * control, control);
+			control_block[u].step = step * float(samples);
+
+			// oscillator values at the start of the update
+			float amplitude[NUM_OSCILLATORS], frequency[NUM_OSCILLATORS], waveparam[NUM_OSCILLATORS];
+			for (int o = 0; o < NUM_OSCILLATORS; ++o)
+			{
+				amplitude[o] = osc_config[o].amplitude;
+				frequency[o] = osc_config[o].frequency;
+				waveparam[o] = osc_config[o].waveparam;
+			}
+
+			// apply low-frequency oscillator
+			if (lfo_config.enable)
+			{
+				// get low-frequency oscillator value
+				lfo = lfo_state.Update(lfo_config, control_block[u].step);
+
+				// apply low-frequency oscillator
+				ApplyLFO(lfo);
+			}
+
+			// save control values for the voices
+			// (ramping oscillator values to their new ones; the hard sync
+			// phase still changes once per update)
+			control_block[u].lfo = lfo;
+			for (int o = 0; o < NUM_OSCILLATORS; ++o)
+			{
+				NoteOscillatorConfig &config = control_block[u].osc[o];
+				config = osc_config[o];
+				config.amplitude = amplitude[o];
+				config.amplitude_step = (osc_config[o].amplitude - amplitude[o]) / samples;
+				config.frequency = frequency[o];
+				config.frequency_step = (osc_config[o].frequency - frequency[o]) / samples;
+				config.waveparam = waveparam[o];
+				config.waveparam_step = (osc_config[o].waveparam - waveparam[o]) / samples;
+			}
+		}
+
+		// assign active voices to filter banks
+		render_banks = 0;
+		for (int i = 0; i < voice_active_count; ++i)
+		{
+			int const v = index[i];
+			int const b = v / FILTER_LANES;
+			if (bank_active[b] == 0)
+				render_bank[render_banks++] = b;
+			bank_index[b][bank_active[b]++] = v;
+		}
+
+		// render filter banks in parallel
+		RenderJob job = { length, step, osc_key_freq, flt_key_freq };
+		WorkerRun(RenderBank, &job, render_banks);
+
+		// accumulate filter bank results in bank order
+		// (so the result does not depend on the number of threads)
+		float mix[RENDER_BLOCK_SAMPLES];
+		memset(mix, 0, length * sizeof(mix[0]));
+		for (int r = 0; r < render_banks; ++r)
+		{
+			float const * const bank = bank_mix[render_bank[r]];
+			for (size_t c = 0; c < length; ++c)
+				mix[c] += bank[c];
+		}
+
+		// release filter banks for the next block
+		for (int r = 0; r < render_banks; ++r)
+			bank_active[render_bank[r]] = 0;
+
+		// free finished voices and update the rest's stealing priority
+		for (int i = 0; i < voice_active_count; ++i)
+		{
+			int const v = index[i];
+			if (voice_finished[v])
+			{
+				VoiceFree(v);
+				--i;
+			}
+			else
+			{
+				VoiceUpdate(v);
+			}
+		}
+
+		// left and right channels are the same
+		//short const output = short(Clamp(int(sample * output_scale * 32768), SHRT_MIN, SHRT_MAX));
+		//short const output = short(FastTanh(sample * output_scale) * 32767);
+		//float const output = FastTanh(sample * output_scale);
+		for (size_t c = 0; c < length; ++c)
+		{
+			float const output = mix[c] * output_scale;
+			*buffer++ = output;
+			*buffer++ = output;
+		}
+	}
+
+	// restore denormal
+	RestoreDenormals(prev);
+}
+
+// apply an event on the audio thread
+static void ApplyEvent(Event const &event)
+{
+	switch (event.type)
+	{
+	case EVENT_NOTE_OFF:
+		NoteOff(event.data1, event.data2);
+		break;
+	case EVENT_NOTE_ON:
+		NoteOn(event.data1, event.data2);
+		break;
+	case EVENT_ALL_SOUND_OFF:
+		while (voice_active_count > 0)
+		{
+			int const v = voice_active[voice_active_count - 1];
+			NoteOff(voice_note[v], 0);
+			amp_env_state[v].amplitude = 0;
+			amp_env_state[v].state = EnvelopeState::OFF;
+			VoiceFree(v);
+		}
+		break;
+	case EVENT_ALL_NOTES_OFF:
+		for (int i = 0; i < voice_active_count; ++i)
+			NoteOff(voice_note[voice_active[i]], 0);
+		break;
+	case EVENT_RESET_CONTROLLERS:
+		Control::ResetAll();
+		break;
+	case EVENT_PITCH_WHEEL:
+		Control::SetPitchWheel(event.data1);
+		break;
+	}
+}
+
+// render stereo interleaved output samples
+// (applies queued events at their sample positions)
+void Render(float buffer[], size_t count)
+{
+	// publish the sample clock to event producers
+	EventSync(render_clock, count);
+
+	size_t offset = 0;
+	do
+	{
+		// apply events due by the current sample
+		// (late events apply immediately)
+		Event event;
+		while (EventNext(render_clock + offset + 1, event))
+			ApplyEvent(event);
+
+		// render up to the next event
+		size_t length = count - offset;
+		unsigned long long next;
+		if (EventPeek(next) && next < render_clock + count)
+			length = size_t(Max(next, render_clock + offset + 1) - render_clock) - offset;
+		RenderSegment(buffer + offset * 2, length);
+		offset += length;
+	}
+	while (offset < count);
+
+	render_clock += count;
+}
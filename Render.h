@@ -0,0 +1,29 @@
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Audio Rendering
+*/
+
+// output sample rate
+extern unsigned int render_frequency;
+
+// output scale factor
+extern float output_scale;
+
+// range of samples per control update
+#define CONTROL_SAMPLES_MIN 8
+#define CONTROL_SAMPLES_MAX 256
+
+// samples per control update
+// (modulation is computed once per update and ramped across it)
+extern size_t render_control_samples;
+
+// set the number of samples per control update
+// (clamped to CONTROL_SAMPLES_MIN..CONTROL_SAMPLES_MAX)
+extern void SetControlSamples(int samples);
+
+// render stereo interleaved output samples
+// (shared by the audio stream and the offline renderer)
+extern void Render(float buffer[], size_t count);
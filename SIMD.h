@@ -0,0 +1,362 @@
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+SIMD Vectors
+(packed floating-point values processed in parallel lanes)
+*/
+
+#if defined(__AVX__)
+#define SIMD_AVX
+#include <immintrin.h>
+#elif defined(_M_X64) || _M_IX86_FP >= 2 || defined(__SSE2__)
+#define SIMD_SSE
+#include <emmintrin.h>
+#if defined(__SSE4_1__)
+// rounding instructions
+#define SIMD_SSE41
+#include <smmintrin.h>
+#endif
+#else
+#define SIMD_GENERIC
+#endif
+
+#include "Math.h"
+
+// number of lanes per vector
+#if defined(SIMD_AVX)
+#define SIMD_WIDTH 8
+#else
+#define SIMD_WIDTH 4
+#endif
+
+// alignment for lane arrays
+#if defined(_MSC_VER)
+#define SIMD_ALIGN __declspec(align(32))
+#else
+#define SIMD_ALIGN __attribute__((aligned(32)))
+#endif
+
+// packed floating-point values
+struct SIMDFloat
+{
+#if defined(SIMD_AVX)
+
+	__m256 v;
+
+	SIMDFloat() {}
+	SIMDFloat(__m256 v) : v(v) {}
+	SIMDFloat(float f) : v(_mm256_set1_ps(f)) {}
+
+	static SIMDFloat Load(float const *p) { return _mm256_loadu_ps(p); }
+	void Store(float *p) const { _mm256_storeu_ps(p, v); }
+
+	// store integer-valued lanes as integers
+	void StoreInt(int *p) const { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), _mm256_cvtps_epi32(v)); }
+
+	friend SIMDFloat operator+(SIMDFloat a, SIMDFloat b) { return _mm256_add_ps(a.v, b.v); }
+	friend SIMDFloat operator-(SIMDFloat a, SIMDFloat b) { return _mm256_sub_ps(a.v, b.v); }
+	friend SIMDFloat operator*(SIMDFloat a, SIMDFloat b) { return _mm256_mul_ps(a.v, b.v); }
+	friend SIMDFloat operator/(SIMDFloat a, SIMDFloat b) { return _mm256_div_ps(a.v, b.v); }
+	friend SIMDFloat Min(SIMDFloat a, SIMDFloat b) { return _mm256_min_ps(a.v, b.v); }
+	friend SIMDFloat Max(SIMDFloat a, SIMDFloat b) { return _mm256_max_ps(a.v, b.v); }
+	friend SIMDFloat Abs(SIMDFloat a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.v); }
+
+	// comparisons return a mask for Select
+	friend SIMDFloat operator<(SIMDFloat a, SIMDFloat b) { return _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ); }
+	friend SIMDFloat operator>(SIMDFloat a, SIMDFloat b) { return _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ); }
+	friend SIMDFloat operator>=(SIMDFloat a, SIMDFloat b) { return _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ); }
+	friend SIMDFloat Select(SIMDFloat mask, SIMDFloat a, SIMDFloat b) { return _mm256_blendv_ps(b.v, a.v, mask.v); }
+
+	// same result as RoundInt
+	friend SIMDFloat Round(SIMDFloat a)
+	{
+		__m256 const r = _mm256_round_ps(_mm256_add_ps(_mm256_add_ps(a.v, a.v), _mm256_set1_ps(0.5f)), _MM_FROUND_CUR_DIRECTION);
+		return _mm256_floor_ps(_mm256_mul_ps(r, _mm256_set1_ps(0.5f)));
+	}
+
+	// same result as FloorInt
+	friend SIMDFloat Floor(SIMDFloat a)
+	{
+		__m256 const r = _mm256_round_ps(_mm256_add_ps(_mm256_add_ps(a.v, a.v), _mm256_set1_ps(-0.5f)), _MM_FROUND_CUR_DIRECTION);
+		return _mm256_floor_ps(_mm256_mul_ps(r, _mm256_set1_ps(0.5f)));
+	}
+
+	// same result as CeilingInt
+	friend SIMDFloat Ceiling(SIMDFloat a)
+	{
+		__m256 const r = _mm256_round_ps(_mm256_sub_ps(_mm256_set1_ps(-0.5f), _mm256_add_ps(a.v, a.v)), _MM_FROUND_CUR_DIRECTION);
+		return _mm256_sub_ps(_mm256_setzero_ps(), _mm256_floor_ps(_mm256_mul_ps(r, _mm256_set1_ps(0.5f))));
+	}
+
+	// same result as TruncateInt
+	friend SIMDFloat Truncate(SIMDFloat a) { return _mm256_round_ps(a.v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC); }
+
+	// 2**a for integer-valued lanes in [-126, 127]
+	// (converts the biased exponent to an integer already in position)
+	friend SIMDFloat Pow2Int(SIMDFloat a) { return _mm256_castsi256_ps(_mm256_cvtps_epi32(_mm256_mul_ps(_mm256_add_ps(a.v, _mm256_set1_ps(127.0f)), _mm256_set1_ps(8388608.0f)))); }
+
+	// exponent and mantissa of positive normal lanes
+	// (a = Mantissa(a) * 2**Exponent(a) with the mantissa in [1, 2))
+	friend SIMDFloat Exponent(SIMDFloat a) { return _mm256_sub_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_castps_si256(_mm256_and_ps(a.v, _mm256_castsi256_ps(_mm256_set1_epi32(0x7F800000))))), _mm256_set1_ps(1.0f / 8388608.0f)), _mm256_set1_ps(127.0f)); }
+	friend SIMDFloat Mantissa(SIMDFloat a) { return _mm256_or_ps(_mm256_and_ps(a.v, _mm256_castsi256_ps(_mm256_set1_epi32(0x007FFFFF))), _mm256_set1_ps(1.0f)); }
+
+#elif defined(SIMD_SSE)
+
+	__m128 v;
+
+	SIMDFloat() {}
+	SIMDFloat(__m128 v) : v(v) {}
+	SIMDFloat(float f) : v(_mm_set1_ps(f)) {}
+
+	static SIMDFloat Load(float const *p) { return _mm_loadu_ps(p); }
+	void Store(float *p) const { _mm_storeu_ps(p, v); }
+
+	// store integer-valued lanes as integers
+	void StoreInt(int *p) const { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), _mm_cvtps_epi32(v)); }
+
+	friend SIMDFloat operator+(SIMDFloat a, SIMDFloat b) { return _mm_add_ps(a.v, b.v); }
+	friend SIMDFloat operator-(SIMDFloat a, SIMDFloat b) { return _mm_sub_ps(a.v, b.v); }
+	friend SIMDFloat operator*(SIMDFloat a, SIMDFloat b) { return _mm_mul_ps(a.v, b.v); }
+	friend SIMDFloat operator/(SIMDFloat a, SIMDFloat b) { return _mm_div_ps(a.v, b.v); }
+	friend SIMDFloat Min(SIMDFloat a, SIMDFloat b) { return _mm_min_ps(a.v, b.v); }
+	friend SIMDFloat Max(SIMDFloat a, SIMDFloat b) { return _mm_max_ps(a.v, b.v); }
+	friend SIMDFloat Abs(SIMDFloat a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a.v); }
+
+	// comparisons return a mask for Select
+	friend SIMDFloat operator<(SIMDFloat a, SIMDFloat b) { return _mm_cmplt_ps(a.v, b.v); }
+	friend SIMDFloat operator>(SIMDFloat a, SIMDFloat b) { return _mm_cmpgt_ps(a.v, b.v); }
+	friend SIMDFloat operator>=(SIMDFloat a, SIMDFloat b) { return _mm_cmpge_ps(a.v, b.v); }
+	friend SIMDFloat Select(SIMDFloat mask, SIMDFloat a, SIMDFloat b) { return _mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v)); }
+
+#if defined(SIMD_SSE41)
+
+	// same result as RoundInt
+	friend SIMDFloat Round(SIMDFloat a)
+	{
+		__m128 const r = _mm_round_ps(_mm_add_ps(_mm_add_ps(a.v, a.v), _mm_set1_ps(0.5f)), _MM_FROUND_CUR_DIRECTION);
+		return _mm_floor_ps(_mm_mul_ps(r, _mm_set1_ps(0.5f)));
+	}
+
+	// same result as FloorInt
+	friend SIMDFloat Floor(SIMDFloat a)
+	{
+		__m128 const r = _mm_round_ps(_mm_add_ps(_mm_add_ps(a.v, a.v), _mm_set1_ps(-0.5f)), _MM_FROUND_CUR_DIRECTION);
+		return _mm_floor_ps(_mm_mul_ps(r, _mm_set1_ps(0.5f)));
+	}
+
+	// same result as CeilingInt
+	friend SIMDFloat Ceiling(SIMDFloat a)
+	{
+		__m128 const r = _mm_round_ps(_mm_sub_ps(_mm_set1_ps(-0.5f), _mm_add_ps(a.v, a.v)), _MM_FROUND_CUR_DIRECTION);
+		return _mm_sub_ps(_mm_setzero_ps(), _mm_floor_ps(_mm_mul_ps(r, _mm_set1_ps(0.5f))));
+	}
+
+	// same result as TruncateInt
+	friend SIMDFloat Truncate(SIMDFloat a) { return _mm_round_ps(a.v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC); }
+
+#else
+
+	// same result as RoundInt
+	friend SIMDFloat Round(SIMDFloat a)
+	{
+		__m128i const r = _mm_cvtps_epi32(_mm_add_ps(_mm_add_ps(a.v, a.v), _mm_set1_ps(0.5f)));
+		return _mm_cvtepi32_ps(_mm_srai_epi32(r, 1));
+	}
+
+	// same result as FloorInt
+	friend SIMDFloat Floor(SIMDFloat a)
+	{
+		__m128i const r = _mm_cvtps_epi32(_mm_add_ps(_mm_add_ps(a.v, a.v), _mm_set1_ps(-0.5f)));
+		return _mm_cvtepi32_ps(_mm_srai_epi32(r, 1));
+	}
+
+	// same result as CeilingInt
+	friend SIMDFloat Ceiling(SIMDFloat a)
+	{
+		__m128i const r = _mm_cvtps_epi32(_mm_sub_ps(_mm_set1_ps(-0.5f), _mm_add_ps(a.v, a.v)));
+		return _mm_cvtepi32_ps(_mm_sub_epi32(_mm_setzero_si128(), _mm_srai_epi32(r, 1)));
+	}
+
+	// same result as TruncateInt
+	friend SIMDFloat Truncate(SIMDFloat a) { return _mm_cvtepi32_ps(_mm_cvttps_epi32(a.v)); }
+
+#endif
+
+	// 2**a for integer-valued lanes in [-126, 127]
+	// (converts the biased exponent to an integer already in position)
+	friend SIMDFloat Pow2Int(SIMDFloat a) { return _mm_castsi128_ps(_mm_cvtps_epi32(_mm_mul_ps(_mm_add_ps(a.v, _mm_set1_ps(127.0f)), _mm_set1_ps(8388608.0f)))); }
+
+	// exponent and mantissa of positive normal lanes
+	// (a = Mantissa(a) * 2**Exponent(a) with the mantissa in [1, 2))
+	friend SIMDFloat Exponent(SIMDFloat a) { return _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_castps_si128(_mm_and_ps(a.v, _mm_castsi128_ps(_mm_set1_epi32(0x7F800000))))), _mm_set1_ps(1.0f / 8388608.0f)), _mm_set1_ps(127.0f)); }
+	friend SIMDFloat Mantissa(SIMDFloat a) { return _mm_or_ps(_mm_and_ps(a.v, _mm_castsi128_ps(_mm_set1_epi32(0x007FFFFF))), _mm_set1_ps(1.0f)); }
+
+#else
+
+	// plain array for targets without vector instructions
+	float v[SIMD_WIDTH];
+
+	SIMDFloat() {}
+	SIMDFloat(float f) { for (int i = 0; i < SIMD_WIDTH; ++i) v[i] = f; }
+
+	static SIMDFloat Load(float const *p) { SIMDFloat r; for (int i = 0; i < SIMD_WIDTH; ++i) r.v[i] = p[i]; return r; }
+	void Store(float *p) const { for (int i = 0; i < SIMD_WIDTH; ++i) p[i] = v[i]; }
+
+	// store integer-valued lanes as integers
+	void StoreInt(int *p) const { for (int i = 0; i < SIMD_WIDTH; ++i) p[i] = int(v[i]); }
+
+	friend SIMDFloat operator+(SIMDFloat a, SIMDFloat b) { for (int i = 0; i < SIMD_WIDTH; ++i) a.v[i] += b.v[i]; return a; }
+	friend SIMDFloat operator-(SIMDFloat a, SIMDFloat b) { for (int i = 0; i < SIMD_WIDTH; ++i) a.v[i] -= b.v[i]; return a; }
+	friend SIMDFloat operator*(SIMDFloat a, SIMDFloat b) { for (int i = 0; i < SIMD_WIDTH; ++i) a.v[i] *= b.v[i]; return a; }
+	friend SIMDFloat operator/(SIMDFloat a, SIMDFloat b) { for (int i = 0; i < SIMD_WIDTH; ++i) a.v[i] /= b.v[i]; return a; }
+	friend SIMDFloat Min(SIMDFloat a, SIMDFloat b) { for (int i = 0; i < SIMD_WIDTH; ++i) a.v[i] = a.v[i] < b.v[i] ? a.v[i] : b.v[i]; return a; }
+	friend SIMDFloat Max(SIMDFloat a, SIMDFloat b) { for (int i = 0; i < SIMD_WIDTH; ++i) a.v[i] = a.v[i] > b.v[i] ? a.v[i] : b.v[i]; return a; }
+	friend SIMDFloat Abs(SIMDFloat a) { for (int i = 0; i < SIMD_WIDTH; ++i) a.v[i] = fabsf(a.v[i]); return a; }
+
+	// comparisons return a mask for Select
+	// (lanes are 1 where true and 0 where false)
+	friend SIMDFloat operator<(SIMDFloat a, SIMDFloat b) { for (int i = 0; i < SIMD_WIDTH; ++i) a.v[i] = float(a.v[i] < b.v[i]); return a; }
+	friend SIMDFloat operator>(SIMDFloat a, SIMDFloat b) { for (int i = 0; i < SIMD_WIDTH; ++i) a.v[i] = float(a.v[i] > b.v[i]); return a; }
+	friend SIMDFloat operator>=(SIMDFloat a, SIMDFloat b) { for (int i = 0; i < SIMD_WIDTH; ++i) a.v[i] = float(a.v[i] >= b.v[i]); return a; }
+	friend SIMDFloat Select(SIMDFloat mask, SIMDFloat a, SIMDFloat b) { for (int i = 0; i < SIMD_WIDTH; ++i) a.v[i] = mask.v[i] != 0 ? a.v[i] : b.v[i]; return a; }
+
+	// same results as the scalar conversions
+	friend SIMDFloat Round(SIMDFloat a) { for (int i = 0; i < SIMD_WIDTH; ++i) a.v[i] = float(RoundInt(a.v[i])); return a; }
+	friend SIMDFloat Floor(SIMDFloat a) { for (int i = 0; i < SIMD_WIDTH; ++i) a.v[i] = float(FloorInt(a.v[i])); return a; }
+	friend SIMDFloat Ceiling(SIMDFloat a) { for (int i = 0; i < SIMD_WIDTH; ++i) a.v[i] = float(CeilingInt(a.v[i])); return a; }
+	friend SIMDFloat Truncate(SIMDFloat a) { for (int i = 0; i < SIMD_WIDTH; ++i) a.v[i] = float(TruncateInt(a.v[i])); return a; }
+
+	// 2**a for integer-valued lanes in [-126, 127]
+	friend SIMDFloat Pow2Int(SIMDFloat a) { for (int i = 0; i < SIMD_WIDTH; ++i) { union { float f; int i; } bits; bits.i = (int(a.v[i]) + 127) << 23; a.v[i] = bits.f; } return a; }
+
+	// exponent and mantissa of positive normal lanes
+	// (a = Mantissa(a) * 2**Exponent(a) with the mantissa in [1, 2))
+	friend SIMDFloat Exponent(SIMDFloat a) { for (int i = 0; i < SIMD_WIDTH; ++i) { union { float f; int i; } bits = { a.v[i] }; a.v[i] = float(((bits.i >> 23) & 0xFF) - 127); } return a; }
+	friend SIMDFloat Mantissa(SIMDFloat a) { for (int i = 0; i < SIMD_WIDTH; ++i) { union { float f; int i; } bits = { a.v[i] }; bits.i = (bits.i & 0x007FFFFF) | 0x3F800000; a.v[i] = bits.f; } return a; }
+
+#endif
+};
+
+// packed unsigned integer values
+// (just the operations the counter-based random generator needs)
+struct SIMDInt
+{
+#if defined(SIMD_AVX) && defined(__AVX2__)
+
+	__m256i v;
+
+	SIMDInt() {}
+	SIMDInt(__m256i v) : v(v) {}
+	SIMDInt(unsigned int i) : v(_mm256_set1_epi32(int(i))) {}
+
+	static SIMDInt Load(unsigned int const *p) { return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p)); }
+	void Store(unsigned int *p) const { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v); }
+
+	friend SIMDInt operator+(SIMDInt a, SIMDInt b) { return _mm256_add_epi32(a.v, b.v); }
+	friend SIMDInt operator^(SIMDInt a, SIMDInt b) { return _mm256_xor_si256(a.v, b.v); }
+	friend SIMDInt operator|(SIMDInt a, SIMDInt b) { return _mm256_or_si256(a.v, b.v); }
+	friend SIMDInt operator<<(SIMDInt a, int n) { return _mm256_sll_epi32(a.v, _mm_cvtsi32_si128(n)); }
+	friend SIMDInt operator>>(SIMDInt a, int n) { return _mm256_srl_epi32(a.v, _mm_cvtsi32_si128(n)); }
+
+	// the same bits as floats
+	friend SIMDFloat AsFloat(SIMDInt a) { return _mm256_castsi256_ps(a.v); }
+
+#elif defined(SIMD_SSE)
+
+	__m128i v;
+
+	SIMDInt() {}
+	SIMDInt(__m128i v) : v(v) {}
+	SIMDInt(unsigned int i) : v(_mm_set1_epi32(int(i))) {}
+
+	static SIMDInt Load(unsigned int const *p) { return _mm_loadu_si128(reinterpret_cast<__m128i const *>(p)); }
+	void Store(unsigned int *p) const { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v); }
+
+	friend SIMDInt operator+(SIMDInt a, SIMDInt b) { return _mm_add_epi32(a.v, b.v); }
+	friend SIMDInt operator^(SIMDInt a, SIMDInt b) { return _mm_xor_si128(a.v, b.v); }
+	friend SIMDInt operator|(SIMDInt a, SIMDInt b) { return _mm_or_si128(a.v, b.v); }
+	friend SIMDInt operator<<(SIMDInt a, int n) { return _mm_sll_epi32(a.v, _mm_cvtsi32_si128(n)); }
+	friend SIMDInt operator>>(SIMDInt a, int n) { return _mm_srl_epi32(a.v, _mm_cvtsi32_si128(n)); }
+
+	// the same bits as floats
+	friend SIMDFloat AsFloat(SIMDInt a) { return _mm_castsi128_ps(a.v); }
+
+#else
+
+	// plain array for targets without vector integer instructions
+	// (including AVX without AVX2)
+	unsigned int v[SIMD_WIDTH];
+
+	SIMDInt() {}
+	SIMDInt(unsigned int i) { for (int l = 0; l < SIMD_WIDTH; ++l) v[l] = i; }
+
+	static SIMDInt Load(unsigned int const *p) { SIMDInt r; for (int l = 0; l < SIMD_WIDTH; ++l) r.v[l] = p[l]; return r; }
+	void Store(unsigned int *p) const { for (int l = 0; l < SIMD_WIDTH; ++l) p[l] = v[l]; }
+
+	friend SIMDInt operator+(SIMDInt a, SIMDInt b) { for (int l = 0; l < SIMD_WIDTH; ++l) a.v[l] += b.v[l]; return a; }
+	friend SIMDInt operator^(SIMDInt a, SIMDInt b) { for (int l = 0; l < SIMD_WIDTH; ++l) a.v[l] ^= b.v[l]; return a; }
+	friend SIMDInt operator|(SIMDInt a, SIMDInt b) { for (int l = 0; l < SIMD_WIDTH; ++l) a.v[l] |= b.v[l]; return a; }
+	friend SIMDInt operator<<(SIMDInt a, int n) { for (int l = 0; l < SIMD_WIDTH; ++l) a.v[l] <<= n; return a; }
+	friend SIMDInt operator>>(SIMDInt a, int n) { for (int l = 0; l < SIMD_WIDTH; ++l) a.v[l] >>= n; return a; }
+
+	// the same bits as floats
+	friend SIMDFloat AsFloat(SIMDInt a) { float f[SIMD_WIDTH]; memcpy(f, a.v, sizeof(f)); return SIMDFloat::Load(f); }
+
+#endif
+};
+
+// fast integer conversions of an array
+// (the same results as the scalar versions, SIMD_WIDTH values at a time)
+#define SIMD_CONVERT_ARRAY(Convert, ConvertInt) \
+static inline void ConvertInt(float const x[], int result[], size_t const count) \
+{ \
+	size_t const vector_count = count - count % SIMD_WIDTH; \
+	for (size_t i = 0; i < vector_count; i += SIMD_WIDTH) \
+		Convert(SIMDFloat::Load(x + i)).StoreInt(result + i); \
+	for (size_t i = vector_count; i < count; ++i) \
+		result[i] = ConvertInt(x[i]); \
+}
+SIMD_CONVERT_ARRAY(Round, RoundInt)
+SIMD_CONVERT_ARRAY(Floor, FloorInt)
+SIMD_CONVERT_ARRAY(Ceiling, CeilingInt)
+SIMD_CONVERT_ARRAY(Truncate, TruncateInt)
+#undef SIMD_CONVERT_ARRAY
+
+// fast approximation of tanh()
+// (clamping to [-3, 3] gives the same result as the scalar version)
+static inline SIMDFloat FastTanh(SIMDFloat x)
+{
+	x = Min(Max(x, SIMDFloat(-3.0f)), SIMDFloat(3.0f));
+	return x * (SIMDFloat(27.0f) + x * x) / (SIMDFloat(27.0f) + SIMDFloat(9.0f) * x * x);
+}
+
+// fast approximation of 2**x
+// (the same approximation as the scalar version)
+static inline SIMDFloat FastExp2(SIMDFloat x)
+{
+	x = Min(Max(x, SIMDFloat(-126.0f)), SIMDFloat(126.0f));
+	SIMDFloat const i = Floor(x);
+	return Exp2Polynomial(x - i) * Pow2Int(i);
+}
+
+// fast approximation of log2(x)
+// (the same approximation as the scalar version)
+static inline SIMDFloat FastLog2(SIMDFloat const x)
+{
+	// split into exponent and mantissa in [sqrt(1/2), sqrt(2))
+	SIMDFloat const m = Mantissa(x);
+	SIMDFloat const high = m >= SIMDFloat(1.41421356f);
+	SIMDFloat const e = Exponent(x) + Select(high, SIMDFloat(1.0f), SIMDFloat(0.0f));
+	SIMDFloat const t = Select(high, m * SIMDFloat(0.5f), m) - SIMDFloat(1.0f);
+	return e + t * Log2Polynomial(t);
+}
+
+// fast approximation of sin(2 * pi * phase)
+// (the same approximation as the scalar version)
+static inline SIMDFloat FastSine(SIMDFloat const phase)
+{
+	SIMDFloat const x = Abs(SIMDFloat(4.0f) * (phase - Floor(phase - SIMDFloat(0.25f))) - SIMDFloat(3.0f)) - SIMDFloat(1.0f);
+	return SinePolynomial(x);
+}
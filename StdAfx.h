@@ -1,13 +1,8 @@
-#pragma once
-
-// common includes
-#include <windows.h>
-#include <stdio.h>
-#include <conio.h>
-#include <math.h>
-#include <float.h>
-#include <assert.h>
-
-#include "bass.h"
-
-#define ARRAY_SIZE(x) (sizeof(x)/sizeof(x[0]))
+#pragma once
+
+// common includes
+#include <windows.h>
+#include <conio.h>
+#include "Platform.h"
+
+#include "bass.h"
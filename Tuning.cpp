@@ -0,0 +1,171 @@
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Tuning
+*/
+#include "Platform.h"
+
+#include "Tuning.h"
+#include "Math.h"
+
+// A Scala scale file lists the pitches of one period of a scale:
+// - lines starting with '!' are comments
+// - the first line is a description
+// - the second line is the number of pitches
+// - each pitch is in cents if it contains a period, otherwise a ratio
+//   ("3/2" or "2"); the last pitch is the period, usually 2/1
+// The first degree of the scale (1/1) falls on middle c.
+//
+//     ! pythagorean.scl
+//     Pythagorean C major
+//      7
+//     9/8
+//     81/64
+//     4/3
+//     3/2
+//     27/16
+//     243/128
+//     2/1
+// http://www.huygens-fokker.org/scala/scl_format.html
+
+// largest number of pitches in a scale
+#define TUNING_PITCHES_MAX 1024
+
+// note pitch in octaves relative to middle c
+float tuning_octaves[NOTES];
+
+// tuning change count
+unsigned int tuning_serial = 1;
+
+// build the note table from scale degrees
+// (degree[0] is 0 and period is the pitch of the last degree, in octaves)
+static void SetTuning(float const degree[], int const count, float const period)
+{
+	for (int note = 0; note < NOTES; ++note)
+	{
+		int const key = note - 60;
+		int const octave = (key >= 0 ? key : key - count + 1) / count;
+		tuning_octaves[note] = octave * period + degree[key - octave * count];
+	}
+	++tuning_serial;
+}
+
+// set up twelve-tone equal temperament
+void InitTuning()
+{
+	float degree[12];
+	for (int i = 0; i < 12; ++i)
+		degree[i] = i / 12.0f;
+	SetTuning(degree, 12, 1.0f);
+}
+
+// read the next line that is not a comment
+// (returns NULL at the end of the file)
+static char *ReadScalaLine(FILE *file, char line[], int const size, int &line_number)
+{
+	while (fgets(line, size, file))
+	{
+		++line_number;
+		if (line[0] != '!')
+			return line;
+	}
+	return NULL;
+}
+
+// parse a Scala pitch in octaves
+// (returns false if the text is not a pitch)
+static bool ParseScalaPitch(char const *text, float &octaves)
+{
+	while (isspace((unsigned char)*text))
+		++text;
+
+	// find the end of the value
+	char const *end = text;
+	while (*end && !isspace((unsigned char)*end))
+		++end;
+	if (end == text)
+		return false;
+
+	// cents
+	char *parsed;
+	if (memchr(text, '.', end - text))
+	{
+		double const cents = strtod(text, &parsed);
+		octaves = float(cents / 1200.0);
+		return parsed == end;
+	}
+
+	// ratio
+	long const numerator = strtol(text, &parsed, 10);
+	long denominator = 1;
+	if (*parsed == '/')
+		denominator = strtol(parsed + 1, &parsed, 10);
+	if (parsed != end || numerator <= 0 || denominator <= 0)
+		return false;
+	octaves = float(log2(double(numerator) / double(denominator)));
+	return true;
+}
+
+// load a Scala scale file
+bool LoadTuning(char const *filename)
+{
+	FILE *file = fopen(filename, "r");
+	if (!file)
+	{
+		fprintf(stderr, "Can't open tuning \"%s\"\n", filename);
+		return false;
+	}
+
+	char line[256];
+	int line_number = 0;
+
+	// description and pitch count
+	int count = 0;
+	if (!ReadScalaLine(file, line, sizeof(line), line_number) ||
+		!ReadScalaLine(file, line, sizeof(line), line_number) ||
+		(count = atoi(line)) < 1 || count > TUNING_PITCHES_MAX)
+	{
+		fprintf(stderr, "%s(%d): expected a pitch count from 1 to %d\n", filename, line_number, TUNING_PITCHES_MAX);
+		fclose(file);
+		return false;
+	}
+
+	// pitches
+	// (the first degree is the implicit 1/1 and the last pitch is the period)
+	static float degree[TUNING_PITCHES_MAX + 1];
+	degree[0] = 0.0f;
+	for (int i = 1; i <= count; ++i)
+	{
+		if (!ReadScalaLine(file, line, sizeof(line), line_number) || !ParseScalaPitch(line, degree[i]))
+		{
+			fprintf(stderr, "%s(%d): expected a pitch in cents or a ratio\n", filename, line_number);
+			fclose(file);
+			return false;
+		}
+	}
+
+	fclose(file);
+
+	if (degree[count] <= 0.0f)
+	{
+		fprintf(stderr, "%s: the period must be above 1/1\n", filename);
+		return false;
+	}
+
+	SetTuning(degree, count, degree[count]);
+	return true;
+}
+
+// bring the table up to date with the key follow amount and pitch offset
+void KeyFollowTable::Update(float const new_follow, float const pitch_offset)
+{
+	if (new_follow != follow || serial != tuning_serial)
+	{
+		follow = new_follow;
+		serial = tuning_serial;
+		for (int note = 0; note < NOTES; ++note)
+			frequency[note] = FastExp2(follow * tuning_octaves[note]) * middle_c_frequency;
+	}
+	pitch_scale = FastExp2(follow * pitch_offset);
+}
@@ -0,0 +1,60 @@
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Tuning
+*/
+
+#include "Voice.h"
+
+// note pitch in octaves relative to middle c
+// (twelve-tone equal temperament unless a scale is loaded)
+extern float tuning_octaves[NOTES];
+
+// tuning change count
+// (key follow tables compare against this to know when to rebuild)
+extern unsigned int tuning_serial;
+
+// load a Scala scale file (.scl) with its first degree on middle c
+// (returns false if the file could not be read, leaving the tuning unchanged;
+// load before rendering starts since rendering reads the table without locking)
+extern bool LoadTuning(char const *filename);
+
+// set up twelve-tone equal temperament
+extern void InitTuning();
+
+// note frequencies for one key follow amount
+// (owned by the rendering thread; rebuilt only when the key follow amount or
+// the tuning changes, so each note frequency is a lookup and a multiply)
+class KeyFollowTable
+{
+public:
+	// key follow amount the table was built for
+	float follow;
+
+	// tuning the table was built for
+	unsigned int serial;
+
+	// pitch wheel multiplier for the key follow amount
+	float pitch_scale;
+
+	// note frequencies without the pitch wheel
+	float frequency[NOTES];
+
+	KeyFollowTable()
+		: follow(-1.0f)
+		, serial(0)
+		, pitch_scale(1.0f)
+	{
+	}
+
+	// bring the table up to date with the key follow amount and pitch offset
+	void Update(float const follow, float const pitch_offset);
+
+	// get the frequency of a note
+	float Get(int const note) const
+	{
+		return frequency[note] * pitch_scale;
+	}
+};
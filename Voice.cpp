@@ -1,128 +1,246 @@
-#include "StdAfx.h"
-
-#include "Voice.h"
-#include "OscillatorNote.h"
-#include "Filter.h"
-#include "Amplifier.h"
-#include "Control.h"
-
-// current note assignemnts
-// (via keyboard or midi input)
-unsigned char voice_note[VOICES];
-unsigned char voice_vel[VOICES];
-unsigned char note_voice[NOTES];
-
-// most recent voice triggered
-int voice_most_recent;
-
-// most recent note key pressed
-// (via keyboard or midi input)
-int note_most_recent;
-
-// choose a voice
-int ChooseVoice(int note)
-{
-	int voice = -1;
-
-	// quietest voice
-	int quietest_voice = -1;
-	float quietest_amplitude = FLT_MAX;
-
-	// find a voice to use
-	for (int v = 0; v < VOICES; ++v)
-	{
-		// if retriggering the voice or the voice is currently off...
-		if (voice_note[v] == note || amp_env_state[v].state == EnvelopeState::OFF)
-		{
-			// use this voice
-			voice = v;
-			break;
-		}
-
-		// if the voice is quieter than the current quietest...
-		if (amp_env_state[v].amplitude < quietest_amplitude)
-		{
-			// use that
-			quietest_voice = v;
-			quietest_amplitude = amp_env_state[v].amplitude;
-		}
-	}
-
-	// use the quietest voice if not already assigned a voice
-	if (voice < 0)
-	{
-		voice = quietest_voice;
-	}
-
-	return voice;
-}
-
-// note frequency
-float NoteFrequency(int note, float follow)
-{
-	float const base = (note - 60) / 12.0f + Control::pitch_offset;
-	return powf(2, follow * base) * middle_c_frequency;
-}
-
-// note on
-int NoteOn(int note, int velocity)
-{
-	// choose a voice
-	int voice = ChooseVoice(note);
-	if (voice < 0)
-		return voice;
-
-	// set most recent voice and note
-	voice_most_recent = voice;
-	note_most_recent = note;
-
-	// set voice note
-	voice_note[voice] = unsigned char(note);
-	note_voice[note] = unsigned char(voice);
-
-	// set voice velocity
-	voice_vel[voice] = unsigned char(velocity);
-
-	// start the oscillator
-	// (assume restart on key)
-	for (int o = 0; o < NUM_OSCILLATORS; ++o)
-		osc_state[voice][o].Start();
-
-	// start the filter
-	flt_state[voice].Reset();
-
-	// if the volume envelope is off, reset the filter envelope
-	// (it should be free-running instead)
-	if (amp_env_state[voice].state == EnvelopeState::OFF)
-	{
-		flt_env_state[voice].state = EnvelopeState::OFF;
-		flt_env_state[voice].amplitude = 0;
-	}
-
-	// gate the volume envelope
-	amp_env_state[voice].Gate(amp_env_config, true);
-
-	// gate the filter envelope
-	flt_env_state[voice].Gate(flt_env_config, true);
-
-	return voice;
-}
-
-// note off
-int NoteOff(int note, int velocity)
-{
-	// find the voice for the note
-	int voice = note_voice[note];
-	if (voice < 0)
-		return voice;
-
-	// TO DO: use note-off velocity
-
-	// gate the volume envelope
-	amp_env_state[voice].Gate(amp_env_config, false);
-
-	// gate the filter envelope
-	flt_env_state[voice].Gate(flt_env_config, false);
-
-	return voice;
-}
+#include "Platform.h"
+
+#include "Voice.h"
+#include "OscillatorNote.h"
+#include "Filter.h"
+#include "Amplifier.h"
+#include "Control.h"
+#include "Tuning.h"
+#include "Math.h"
+
+// number of voices
+int voice_count;
+
+// current note assignemnts
+// (via keyboard or midi input)
+unsigned char voice_note[VOICES_MAX];
+unsigned char voice_vel[VOICES_MAX];
+
+// voice assigned to each note
+// (-1 if none)
+static short note_voice[NOTES];
+
+// most recent voice triggered
+int voice_most_recent;
+
+// most recent note key pressed
+// (via keyboard or midi input)
+int note_most_recent;
+
+// active voices and each voice's position in the list
+// (-1 if not active)
+int voice_active[VOICES_MAX];
+int voice_active_count;
+static int voice_active_pos[VOICES_MAX];
+
+// free voices
+// (a stack, so recently freed voices get reused first)
+static int voice_free[VOICES_MAX];
+static int voice_free_count;
+
+// active voices bucketed by volume envelope amplitude for stealing
+// (doubly-linked lists with a bit mask of non-empty buckets,
+// so finding the quietest voice takes constant time)
+static int const VOICE_BUCKETS = 64;
+static int bucket_head[VOICE_BUCKETS];
+static unsigned long long bucket_mask;
+static int voice_bucket[VOICES_MAX];
+static int voice_bucket_next[VOICES_MAX];
+static int voice_bucket_prev[VOICES_MAX];
+
+// bucket for an amplitude
+// (quarter-octave steps from the float bits, which order the same
+// way as the values; everything below about -90dB shares bucket 0)
+static inline int AmplitudeBucket(float amplitude)
+{
+	union { float f; unsigned int u; } bits = { Max(amplitude, 0.0f) };
+	int const bucket = int(bits.u >> 21) - (0x3F800000 >> 21) + VOICE_BUCKETS - 4;
+	return Clamp(bucket, 0, VOICE_BUCKETS - 1);
+}
+
+// add a voice to a stealing bucket
+static void BucketInsert(int voice, int bucket)
+{
+	voice_bucket[voice] = bucket;
+	voice_bucket_prev[voice] = -1;
+	voice_bucket_next[voice] = bucket_head[bucket];
+	if (bucket_head[bucket] >= 0)
+		voice_bucket_prev[bucket_head[bucket]] = voice;
+	bucket_head[bucket] = voice;
+	bucket_mask |= 1ULL << bucket;
+}
+
+// remove a voice from its stealing bucket
+static void BucketRemove(int voice)
+{
+	int const bucket = voice_bucket[voice];
+	int const prev = voice_bucket_prev[voice];
+	int const next = voice_bucket_next[voice];
+	if (prev >= 0)
+		voice_bucket_next[prev] = next;
+	else
+		bucket_head[bucket] = next;
+	if (next >= 0)
+		voice_bucket_prev[next] = prev;
+	if (bucket_head[bucket] < 0)
+		bucket_mask &= ~(1ULL << bucket);
+}
+
+// set the number of voices and stop them all
+void VoiceInit(int count)
+{
+	voice_count = Clamp(count, 1, VOICES_MAX);
+
+	for (int n = 0; n < NOTES; ++n)
+		note_voice[n] = -1;
+
+	for (int b = 0; b < VOICE_BUCKETS; ++b)
+		bucket_head[b] = -1;
+	bucket_mask = 0;
+
+	voice_active_count = 0;
+	voice_free_count = 0;
+	for (int v = VOICES_MAX - 1; v >= 0; --v)
+	{
+		amp_env_state[v].state = EnvelopeState::OFF;
+		amp_env_state[v].amplitude = 0;
+		voice_active_pos[v] = -1;
+		if (v < voice_count)
+			voice_free[voice_free_count++] = v;
+	}
+}
+
+// update a voice's stealing priority
+void VoiceUpdate(int voice)
+{
+	int const bucket = AmplitudeBucket(amp_env_state[voice].amplitude);
+	if (bucket != voice_bucket[voice])
+	{
+		BucketRemove(voice);
+		BucketInsert(voice, bucket);
+	}
+}
+
+// return a finished voice to the free list
+void VoiceFree(int voice)
+{
+	int const pos = voice_active_pos[voice];
+	if (pos < 0)
+		return;
+
+	// swap the last active voice into its place
+	int const last = voice_active[--voice_active_count];
+	voice_active[pos] = last;
+	voice_active_pos[last] = pos;
+	voice_active_pos[voice] = -1;
+
+	BucketRemove(voice);
+
+	// release the note assignment
+	if (note_voice[voice_note[voice]] == voice)
+		note_voice[voice_note[voice]] = -1;
+
+	voice_free[voice_free_count++] = voice;
+}
+
+// choose a voice
+static int ChooseVoice(int note)
+{
+	// if retriggering the voice playing the note, use that
+	int voice = note_voice[note];
+	if (voice >= 0)
+	{
+		BucketRemove(voice);
+		return voice;
+	}
+
+	// if there is a free voice, make it active
+	if (voice_free_count > 0)
+	{
+		voice = voice_free[--voice_free_count];
+		voice_active_pos[voice] = voice_active_count;
+		voice_active[voice_active_count++] = voice;
+		return voice;
+	}
+
+	// otherwise steal the quietest voice
+	if (!bucket_mask)
+		return -1;
+	voice = bucket_head[LowestBit(bucket_mask)];
+	BucketRemove(voice);
+	note_voice[voice_note[voice]] = -1;
+	return voice;
+}
+
+// note frequency
+float NoteFrequency(int note, float follow)
+{
+	float const base = tuning_octaves[note] + Control::pitch_offset;
+	return FastExp2(follow * base) * middle_c_frequency;
+}
+
+// note on
+int NoteOn(int note, int velocity)
+{
+	// choose a voice
+	int voice = ChooseVoice(note);
+	if (voice < 0)
+		return voice;
+
+	// set most recent voice and note
+	voice_most_recent = voice;
+	note_most_recent = note;
+
+	// set voice note
+	voice_note[voice] = (unsigned char)note;
+	note_voice[note] = short(voice);
+
+	// keep the voice from being stolen until it renders
+	BucketInsert(voice, VOICE_BUCKETS - 1);
+
+	// set voice velocity
+	voice_vel[voice] = (unsigned char)velocity;
+
+	// start the oscillator
+	// (assume restart on key)
+	for (int o = 0; o < NUM_OSCILLATORS; ++o)
+		osc_state[voice][o].Start();
+
+	// start the filter
+	flt_bank[voice / FILTER_LANES].Reset(voice % FILTER_LANES);
+
+	// if the volume envelope is off, reset the filter envelope
+	// (it should be free-running instead)
+	if (amp_env_state[voice].state == EnvelopeState::OFF)
+	{
+		flt_env_state[voice].state = EnvelopeState::OFF;
+		flt_env_state[voice].amplitude = 0;
+	}
+
+	// gate the volume envelope
+	amp_env_state[voice].Gate(amp_env_config, true);
+
+	// gate the filter envelope
+	flt_env_state[voice].Gate(flt_env_config, true);
+
+	return voice;
+}
+
+// note off
+int NoteOff(int note, int velocity)
+{
+	// find the voice for the note
+	int voice = note_voice[note];
+	if (voice < 0)
+		return voice;
+
+	// TO DO: use note-off velocity
+
+	// gate the volume envelope
+	amp_env_state[voice].Gate(amp_env_config, false);
+
+	// gate the filter envelope
+	flt_env_state[voice].Gate(flt_env_config, false);
+
+	return voice;
+}
@@ -1,42 +1,64 @@
-#pragma once
-/*
-MINI VIRTUAL ANALOG SYNTHESIZER
-Copyright 2014 Kenneth D. Miller III
-
-Voice Assignment
-*/
-
-// frequency of middle c
-const float middle_c_frequency = 261.6255653005986346778499935233f;
-//const float middle_c_frequency = 256.0f;
-
-
-// midi note frequencies
-// (11 octaves + 1)
-#define NOTES 133
-
-// number of voices
-#define VOICES 16
-
-// current note assignemnts
-// (via keyboard or midi input)
-extern unsigned char voice_note[VOICES];
-extern unsigned char voice_vel[VOICES];
-
-// most recent voice triggered
-extern int voice_most_recent;
-
-// most recent note key pressed
-// (via keyboard or midi input)
-extern int note_most_recent;
-
-// note frequency
-extern float NoteFrequency(int note, float follow);
-
-// note on
-// (returns voice index)
-extern int NoteOn(int note, int velocity = 64);
-
-// note off
-// (returns voice index)
-extern int NoteOff(int note, int velocity = 64);
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Voice Assignment
+*/
+
+// frequency of middle c
+const float middle_c_frequency = 261.6255653005986346778499935233f;
+//const float middle_c_frequency = 256.0f;
+
+
+// midi note frequencies
+// (11 octaves + 1)
+#define NOTES 133
+
+// maximum number of voices
+#define VOICES_MAX 1024
+
+// default number of voices
+#define VOICES_DEFAULT 16
+
+// number of voices
+// (set at startup by VoiceInit)
+extern int voice_count;
+
+// current note assignemnts
+// (via keyboard or midi input)
+extern unsigned char voice_note[VOICES_MAX];
+extern unsigned char voice_vel[VOICES_MAX];
+
+// active voices in no particular order
+// (maintained incrementally by NoteOn and VoiceFree)
+extern int voice_active[VOICES_MAX];
+extern int voice_active_count;
+
+// most recent voice triggered
+extern int voice_most_recent;
+
+// most recent note key pressed
+// (via keyboard or midi input)
+extern int note_most_recent;
+
+// note frequency
+// (in the current tuning; rendering looks these up in KeyFollowTable instead)
+extern float NoteFrequency(int note, float follow);
+
+// note on
+// (returns voice index)
+extern int NoteOn(int note, int velocity = 64);
+
+// note off
+// (returns voice index)
+extern int NoteOff(int note, int velocity = 64);
+
+// set the number of voices and stop them all
+extern void VoiceInit(int count);
+
+// update a voice's stealing priority from its volume envelope amplitude
+extern void VoiceUpdate(int voice);
+
+// return a voice whose volume envelope finished to the free list
+extern void VoiceFree(int voice);
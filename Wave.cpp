@@ -1,109 +1,261 @@
-/*
-MINI VIRTUAL ANALOG SYNTHESIZER
-Copyright 2014 Kenneth D. Miller III
-
-Wave Types
-*/
-#include "StdAfx.h"
-
-#include "Wave.h"
-#include "WaveSine.h"
-#include "WavePulse.h"
-#include "WaveSawtooth.h"
-#include "WaveTriangle.h"
-#include "WaveNoise.h"
-#include "WavePoly.h"
-#include "WaveHold.h"
-
-// waveform antialiasing
-bool use_antialias = true;
-
-// map wave type enumeration to oscillator function
-WaveEvaluate const wave_evaluate[WAVE_COUNT] =
-{
-	OscillatorSine,			// WAVE_SINE,
-	OscillatorPulse,		// WAVE_PULSE,
-	OscillatorSawtooth,		// WAVE_SAWTOOTH,
-	OscillatorTriangle,		// WAVE_TRIANGLE,
-	OscillatorNoise,		// WAVE_NOISE,
-	OscillatorNoiseHold,	// WAVE_NOISE_HOLD
-	OscillatorNoiseSlope,	// WAVE_NOISE_SLOPE
-	OscillatorPoly,			// WAVE_POLY4,
-	OscillatorPoly,			// WAVE_POLY5,
-	OscillatorPoly,			// WAVE_PERIOD93,
-	OscillatorPoly,			// WAVE_POLY9,
-	OscillatorPoly,			// WAVE_POLY17,
-	OscillatorPoly,			// WAVE_PULSE_POLY5,
-	OscillatorPoly,			// WAVE_POLY4_POLY5,
-	OscillatorPoly,			// WAVE_POLY17_POLY5,
-};
-
-// names for wave types
-char const * const wave_name[WAVE_COUNT] =
-{
-	"Sine",			// WAVE_SINE,
-	"Pulse",		// WAVE_PULSE,
-	"Sawtooth",		// WAVE_SAWTOOTH,
-	"Triangle",		// WAVE_TRIANGLE,
-	"Noise",		// WAVE_NOISE,
-	"Noise Hold",	// WAVE_NOISE_HOLD
-	"Noise Slope",	// WAVE_NOISE_SLOPE
-	"Poly4",		// WAVE_POLY4,
-	"Poly5",		// WAVE_POLY5,
-	"Period-93",	// WAVE_PERIOD93,
-	"Poly9",		// WAVE_POLY9,
-	"Poly17",		// WAVE_POLY17,
-	"Pulse/Poly5",	// WAVE_PULSE_POLY5,
-	"Poly4/Poly5",	// WAVE_POLY4_POLY5,
-	"Poly17/Poly5"	// WAVE_POLY17_POLY5,
-};
-
-// multiply oscillator time scale based on wave type
-// - tune the pitch of short-period poly oscillators
-// - raise the pitch of poly oscillators by a factor of two
-// - Atari POKEY pitch 255 corresponds to key 9 (N) in octave 2
-float const wave_adjust_frequency[WAVE_COUNT] =
-{
-	1.0f,					// WAVE_SINE,
-	1.0f,					// WAVE_PULSE,
-	1.0f,					// WAVE_SAWTOOTH,
-	1.0f,					// WAVE_TRIANGLE,
-	1.0f, 					// WAVE_NOISE,
-	1.0f,					// WAVE_NOISE_HOLD,
-	1.0f,					// WAVE_NOISE_SLOPE,
-	2.0f * 15.0f / 16.0f,	// WAVE_POLY4,
-	2.0f * 31.0f / 32.0f,	// WAVE_POLY5,
-	2.0f * 93.0f / 128.0f,	// WAVE_PERIOD93,
-	2.0f * 511.0f / 512.0f,	// WAVE_POLY9,
-	2.0f,					// WAVE_POLY17,
-	2.0f * 31.0f / 32.0f,	// WAVE_PULSE_POLY5,
-	2.0f * 465.0f / 512.0f,	// WAVE_POLY4_POLY5,
-	2.0f,					// WAVE_POLY17_POLY5,
-};
-
-// restart the oscillator loop index after this many phase cycles
-// - poly oscillators using the loop index to look up precomputed values
-int const wave_loop_cycle[WAVE_COUNT] =
-{
-	INT_MAX,					// WAVE_SINE,
-	INT_MAX,					// WAVE_PULSE,
-	INT_MAX,					// WAVE_SAWTOOTH,
-	INT_MAX,					// WAVE_TRIANGLE,
-	INT_MAX,					// WAVE_NOISE,
-	ARRAY_SIZE(noise),			// WAVE_NOISE_HOLD
-	ARRAY_SIZE(noise),			// WAVE_NOISE_SLOPE
-	ARRAY_SIZE(poly4),			// WAVE_POLY4,
-	ARRAY_SIZE(poly5),			// WAVE_POLY5,
-	ARRAY_SIZE(period93),		// WAVE_PERIOD93,
-	ARRAY_SIZE(poly9),			// WAVE_POLY9,
-	ARRAY_SIZE(poly17),			// WAVE_POLY17,
-	ARRAY_SIZE(pulsepoly5),		// WAVE_PULSE_POLY5,
-	ARRAY_SIZE(poly4poly5),		// WAVE_POLY4_POLY5,
-	ARRAY_SIZE(poly17poly5),	// WAVE_POLY17_POLY5,
-};
-
-void InitWave()
-{
-	InitPoly();
-	InitNoise();
-}
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Wave Types
+*/
+#include "Platform.h"
+
+#include "Wave.h"
+#include "WaveSine.h"
+#include "WavePulse.h"
+#include "WaveSawtooth.h"
+#include "WaveTriangle.h"
+#include "WaveNoise.h"
+#include "WavePoly.h"
+#include "WaveHold.h"
+#include "WaveUser.h"
+#include "Wavetable.h"
+#include "MinBLEP.h"
+
+// waveform antialiasing
+bool use_antialias = true;
+AntialiasMethod antialias_method = ANTIALIAS_METHOD_POLYBLEP;
+
+// names for antialiasing methods
+char const * const antialias_method_name[ANTIALIAS_METHOD_COUNT] =
+{
+	"PolyBLEP",		// ANTIALIAS_METHOD_POLYBLEP
+	"Wavetable",	// ANTIALIAS_METHOD_WAVETABLE
+	"MinBLEP",		// ANTIALIAS_METHOD_MINBLEP
+};
+
+// map wave type enumeration to oscillator function
+WaveEvaluate const wave_evaluate[WAVE_COUNT] =
+{
+	OscillatorSine,			// WAVE_SINE,
+	OscillatorPulse,		// WAVE_PULSE,
+	OscillatorSawtooth,		// WAVE_SAWTOOTH,
+	OscillatorTriangle,		// WAVE_TRIANGLE,
+	OscillatorNoise,		// WAVE_NOISE,
+	OscillatorNoiseHold,	// WAVE_NOISE_HOLD
+	OscillatorNoiseSlope,	// WAVE_NOISE_SLOPE
+	OscillatorPoly,			// WAVE_POLY4,
+	OscillatorPoly,			// WAVE_POLY5,
+	OscillatorPoly,			// WAVE_PERIOD93,
+	OscillatorPoly,			// WAVE_POLY9,
+	OscillatorPoly,			// WAVE_POLY17,
+	OscillatorPoly,			// WAVE_PULSE_POLY5,
+	OscillatorPoly,			// WAVE_POLY4_POLY5,
+	OscillatorPoly,			// WAVE_POLY17_POLY5,
+	OscillatorUserWavetable,	// WAVE_TABLE,
+};
+
+// map wave type enumeration to oscillator render functions
+WaveRender const (* const wave_render[WAVE_COUNT])[2][2] =
+{
+	sine_render,			// WAVE_SINE,
+	pulse_render,			// WAVE_PULSE,
+	sawtooth_render,		// WAVE_SAWTOOTH,
+	triangle_render,		// WAVE_TRIANGLE,
+	noise_render,			// WAVE_NOISE,
+	noise_hold_render,		// WAVE_NOISE_HOLD
+	noise_slope_render,		// WAVE_NOISE_SLOPE
+	poly_render,			// WAVE_POLY4,
+	poly_render,			// WAVE_POLY5,
+	poly_render,			// WAVE_PERIOD93,
+	poly_render,			// WAVE_POLY9,
+	poly_render,			// WAVE_POLY17,
+	poly_render,			// WAVE_PULSE_POLY5,
+	poly_render,			// WAVE_POLY4_POLY5,
+	poly_render,			// WAVE_POLY17_POLY5,
+	user_wavetable_render,	// WAVE_TABLE,
+};
+
+// map wave type enumeration to oscillator group functions
+WaveRenderGroup const * const wave_render_group[WAVE_COUNT] =
+{
+	sine_render_group,			// WAVE_SINE,
+	pulse_render_group,			// WAVE_PULSE,
+	sawtooth_render_group,		// WAVE_SAWTOOTH,
+	triangle_render_group,		// WAVE_TRIANGLE,
+	noise_render_group,			// WAVE_NOISE,
+	NULL,						// WAVE_NOISE_HOLD
+	NULL,						// WAVE_NOISE_SLOPE
+	NULL,						// WAVE_POLY4,
+	NULL,						// WAVE_POLY5,
+	NULL,						// WAVE_PERIOD93,
+	NULL,						// WAVE_POLY9,
+	NULL,						// WAVE_POLY17,
+	NULL,						// WAVE_PULSE_POLY5,
+	NULL,						// WAVE_POLY4_POLY5,
+	NULL,						// WAVE_POLY17_POLY5,
+	NULL,						// WAVE_TABLE,
+};
+
+// map wave type enumeration to wavetable render functions
+WaveRender const * const wave_table_render[WAVE_COUNT] =
+{
+	NULL,					// WAVE_SINE,
+	pulse_table_render,		// WAVE_PULSE,
+	sawtooth_table_render,	// WAVE_SAWTOOTH,
+	triangle_table_render,	// WAVE_TRIANGLE,
+	NULL,					// WAVE_NOISE,
+	NULL,					// WAVE_NOISE_HOLD
+	NULL,					// WAVE_NOISE_SLOPE
+	NULL,					// WAVE_POLY4,
+	NULL,					// WAVE_POLY5,
+	NULL,					// WAVE_PERIOD93,
+	NULL,					// WAVE_POLY9,
+	NULL,					// WAVE_POLY17,
+	NULL,					// WAVE_PULSE_POLY5,
+	NULL,					// WAVE_POLY4_POLY5,
+	NULL,					// WAVE_POLY17_POLY5,
+	NULL,					// WAVE_TABLE,
+};
+
+// map wave type enumeration to MinBLEP render functions
+WaveRender const (* const wave_minblep_render[WAVE_COUNT])[2] =
+{
+	NULL,						// WAVE_SINE,
+	pulse_minblep_render,		// WAVE_PULSE,
+	sawtooth_minblep_render,	// WAVE_SAWTOOTH,
+	NULL,						// WAVE_TRIANGLE,
+	NULL,						// WAVE_NOISE,
+	NULL,						// WAVE_NOISE_HOLD
+	NULL,						// WAVE_NOISE_SLOPE
+	NULL,						// WAVE_POLY4,
+	NULL,						// WAVE_POLY5,
+	NULL,						// WAVE_PERIOD93,
+	NULL,						// WAVE_POLY9,
+	NULL,						// WAVE_POLY17,
+	NULL,						// WAVE_PULSE_POLY5,
+	NULL,						// WAVE_POLY4_POLY5,
+	NULL,						// WAVE_POLY17_POLY5,
+	NULL,						// WAVE_TABLE,
+};
+
+// names for wave types
+char const * const wave_name[WAVE_COUNT] =
+{
+	"Sine",			// WAVE_SINE,
+	"Pulse",		// WAVE_PULSE,
+	"Sawtooth",		// WAVE_SAWTOOTH,
+	"Triangle",		// WAVE_TRIANGLE,
+	"Noise",		// WAVE_NOISE,
+	"Noise Hold",	// WAVE_NOISE_HOLD
+	"Noise Slope",	// WAVE_NOISE_SLOPE
+	"Poly4",		// WAVE_POLY4,
+	"Poly5",		// WAVE_POLY5,
+	"Period-93",	// WAVE_PERIOD93,
+	"Poly9",		// WAVE_POLY9,
+	"Poly17",		// WAVE_POLY17,
+	"Pulse/Poly5",	// WAVE_PULSE_POLY5,
+	"Poly4/Poly5",	// WAVE_POLY4_POLY5,
+	"Poly17/Poly5",	// WAVE_POLY17_POLY5,
+	"Wavetable",	// WAVE_TABLE,
+};
+
+// multiply oscillator time scale based on wave type
+// - tune the pitch of short-period poly oscillators
+// - raise the pitch of poly oscillators by a factor of two
+// - Atari POKEY pitch 255 corresponds to key 9 (N) in octave 2
+float const wave_adjust_frequency[WAVE_COUNT] =
+{
+	1.0f,					// WAVE_SINE,
+	1.0f,					// WAVE_PULSE,
+	1.0f,					// WAVE_SAWTOOTH,
+	1.0f,					// WAVE_TRIANGLE,
+	1.0f, 					// WAVE_NOISE,
+	1.0f,					// WAVE_NOISE_HOLD,
+	1.0f,					// WAVE_NOISE_SLOPE,
+	2.0f * 15.0f / 16.0f,	// WAVE_POLY4,
+	2.0f * 31.0f / 32.0f,	// WAVE_POLY5,
+	2.0f * 93.0f / 128.0f,	// WAVE_PERIOD93,
+	2.0f * 511.0f / 512.0f,	// WAVE_POLY9,
+	2.0f,					// WAVE_POLY17,
+	2.0f * 31.0f / 32.0f,	// WAVE_PULSE_POLY5,
+	2.0f * 465.0f / 512.0f,	// WAVE_POLY4_POLY5,
+	2.0f,					// WAVE_POLY17_POLY5,
+	1.0f,					// WAVE_TABLE,
+};
+
+// restart the oscillator loop index after this many phase cycles
+// - poly oscillators using the loop index to look up precomputed values
+int const wave_loop_cycle[WAVE_COUNT] =
+{
+	INT_MAX,					// WAVE_SINE,
+	INT_MAX,					// WAVE_PULSE,
+	INT_MAX,					// WAVE_SAWTOOTH,
+	INT_MAX,					// WAVE_TRIANGLE,
+	INT_MAX,					// WAVE_NOISE,
+	ARRAY_SIZE(noise),			// WAVE_NOISE_HOLD
+	ARRAY_SIZE(noise),			// WAVE_NOISE_SLOPE
+	POLY4_LENGTH,				// WAVE_POLY4,
+	POLY5_LENGTH,				// WAVE_POLY5,
+	PERIOD93_LENGTH,			// WAVE_PERIOD93,
+	POLY9_LENGTH,				// WAVE_POLY9,
+	POLY17_LENGTH,				// WAVE_POLY17,
+	PULSE_POLY5_LENGTH,			// WAVE_PULSE_POLY5,
+	POLY4_POLY5_LENGTH,			// WAVE_POLY4_POLY5,
+	POLY17_POLY5_LENGTH,		// WAVE_POLY17_POLY5,
+	INT_MAX,					// WAVE_TABLE,
+};
+
+void InitWave()
+{
+	for (int w = 0; w < WAVE_COUNT; ++w)
+		InitWaveType(Wave(w));
+	for (int m = 0; m < ANTIALIAS_METHOD_COUNT; ++m)
+		InitAntialiasMethod(AntialiasMethod(m));
+}
+
+// build the tables a wave type uses
+void InitWaveType(Wave const wavetype)
+{
+	static bool built[WAVE_COUNT];
+	if (built[wavetype])
+		return;
+	built[wavetype] = true;
+
+	switch (wavetype)
+	{
+	case WAVE_NOISE_HOLD:
+	case WAVE_NOISE_SLOPE:
+		InitNoise();
+		break;
+	case WAVE_POLY4:
+	case WAVE_POLY5:
+	case WAVE_PERIOD93:
+	case WAVE_POLY9:
+	case WAVE_POLY17:
+	case WAVE_PULSE_POLY5:
+	case WAVE_POLY4_POLY5:
+	case WAVE_POLY17_POLY5:
+		InitPoly(wavetype);
+		break;
+	default:
+		break;
+	}
+}
+
+// build the tables an antialiasing method uses
+void InitAntialiasMethod(AntialiasMethod const method)
+{
+	static bool built[ANTIALIAS_METHOD_COUNT];
+	if (built[method])
+		return;
+	built[method] = true;
+
+	switch (method)
+	{
+	case ANTIALIAS_METHOD_WAVETABLE:
+		InitWavetable();
+		break;
+	case ANTIALIAS_METHOD_MINBLEP:
+		InitMinBLEP();
+		break;
+	default:
+		break;
+	}
+}
@@ -1,57 +1,115 @@
-#pragma once
-/*
-MINI VIRTUAL ANALOG SYNTHESIZER
-Copyright 2014 Kenneth D. Miller III
-
-Wave Types
-*/
-
-// waveform antialiasing
-#define ANTIALIAS_NONE 0
-#define ANTIALIAS_POLYBLEP 1
-#define ANTIALIAS 1
-extern bool use_antialias;
-
-// oscillator wave types
-enum Wave
-{
-	WAVE_SINE,
-	WAVE_PULSE,
-	WAVE_SAWTOOTH,
-	WAVE_TRIANGLE,
-	WAVE_NOISE,
-	WAVE_NOISE_HOLD,
-	WAVE_NOISE_SLOPE,
-
-	WAVE_POLY4,			// Atari POKEY AUDC 12
-	WAVE_POLY5,			// Atari TIA AUDC 7 or 9
-	WAVE_PERIOD93,		// NES Ricoh 2A03 period-93 noise
-	WAVE_POLY9,			// Atari TIA AUDC 8
-	WAVE_POLY17,		// Atari POKEY AUDC 8
-	WAVE_PULSE_POLY5,	// Atari POKEY AUDC 2, 6
-	WAVE_POLY4_POLY5,	// Atari POKEY AUDC 4
-	WAVE_POLY17_POLY5,	// Atari POKEY AUDC 0
-
-	WAVE_COUNT
-};
-
-class OscillatorConfig;
-class OscillatorState;
-
-// wave evaluation function: returns wave value
-typedef float(*WaveEvaluate)(OscillatorConfig const &config, OscillatorState &state, float step);
-
-// map wave type to wave evaluator
-extern WaveEvaluate const wave_evaluate[WAVE_COUNT];
-
-// names for wave types
-extern char const * const wave_name[WAVE_COUNT];
-
-// multiply oscillator time scale based on wave type
-extern float const wave_adjust_frequency[WAVE_COUNT];
-
-// restart the oscillator loop index after this many phase cycles
-extern int const wave_loop_cycle[WAVE_COUNT];
-
-// initialize wave
-extern void InitWave();
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Wave Types
+*/
+
+// waveform antialiasing
+#define ANTIALIAS_NONE 0
+#define ANTIALIAS_POLYBLEP 1
+#define ANTIALIAS 1
+extern bool use_antialias;
+
+// antialiasing methods
+// (chosen at run time when antialiasing is on; wave types without
+// wavetables or step tables use PolyBLEP, and so do hard-synced
+// oscillators with wavetables)
+enum AntialiasMethod
+{
+	ANTIALIAS_METHOD_POLYBLEP,
+	ANTIALIAS_METHOD_WAVETABLE,
+	ANTIALIAS_METHOD_MINBLEP,
+	ANTIALIAS_METHOD_COUNT
+};
+extern AntialiasMethod antialias_method;
+
+// names for antialiasing methods
+extern char const * const antialias_method_name[ANTIALIAS_METHOD_COUNT];
+
+// oscillator wave types
+enum Wave
+{
+	WAVE_SINE,
+	WAVE_PULSE,
+	WAVE_SAWTOOTH,
+	WAVE_TRIANGLE,
+	WAVE_NOISE,
+	WAVE_NOISE_HOLD,
+	WAVE_NOISE_SLOPE,
+
+	WAVE_POLY4,			// Atari POKEY AUDC 12
+	WAVE_POLY5,			// Atari TIA AUDC 7 or 9
+	WAVE_PERIOD93,		// NES Ricoh 2A03 period-93 noise
+	WAVE_POLY9,			// Atari TIA AUDC 8
+	WAVE_POLY17,		// Atari POKEY AUDC 8
+	WAVE_PULSE_POLY5,	// Atari POKEY AUDC 2, 6
+	WAVE_POLY4_POLY5,	// Atari POKEY AUDC 4
+	WAVE_POLY17_POLY5,	// Atari POKEY AUDC 0
+
+	WAVE_TABLE,			// user wavetable loaded from a file
+
+	WAVE_COUNT
+};
+
+class OscillatorConfig;
+class OscillatorState;
+class OscillatorGroup;
+class NoteOscillatorConfig;
+
+// wave evaluation function: returns wave value
+typedef float(*WaveEvaluate)(OscillatorConfig const &config, OscillatorState &state, float step);
+
+// map wave type to wave evaluator
+extern WaveEvaluate const wave_evaluate[WAVE_COUNT];
+
+// wave render function: accumulates wave values for one note oscillator
+// (see OscillatorKernel)
+typedef void(*WaveRender)(NoteOscillatorConfig const &config, OscillatorState &state, float step, float buffer[], size_t count);
+
+// map wave type to wave render functions
+// (indexed by antialiasing, hard sync, and sub-oscillator;
+// choose one per block: wave_render[wavetype][use_antialias][sync_enable][sub_osc])
+extern WaveRender const (* const wave_render[WAVE_COUNT])[2][2];
+
+// wave group function: accumulates wave values for a group of oscillators
+// (without hard sync; see OscillatorGroup)
+typedef void(*WaveRenderGroup)(OscillatorConfig const &config, OscillatorGroup &group, size_t count);
+
+// map wave type to wave group functions
+// (indexed by antialiasing; null for wave types without a vector implementation;
+// each lane matches wave_render to OSCILLATOR_GROUP_TOLERANCE)
+extern WaveRenderGroup const * const wave_render_group[WAVE_COUNT];
+
+// map wave type to wavetable render functions
+// (indexed by sub-oscillator; null for wave types without wavetables;
+// see WavetableKernel)
+extern WaveRender const * const wave_table_render[WAVE_COUNT];
+
+// map wave type to MinBLEP render functions
+// (indexed by hard sync and sub-oscillator; null for wave types without
+// step tables; see MinBLEPKernel)
+extern WaveRender const (* const wave_minblep_render[WAVE_COUNT])[2];
+
+// names for wave types
+extern char const * const wave_name[WAVE_COUNT];
+
+// multiply oscillator time scale based on wave type
+extern float const wave_adjust_frequency[WAVE_COUNT];
+
+// restart the oscillator loop index after this many phase cycles
+extern int const wave_loop_cycle[WAVE_COUNT];
+
+// initialize wave
+// (builds the tables of every wave type and antialiasing method up front,
+// so nothing gets built on the audio thread)
+extern void InitWave();
+
+// build the tables a wave type uses
+// (the first time only; rendering calls this for the wave types in use)
+extern void InitWaveType(Wave const wavetype);
+
+// build the tables an antialiasing method uses
+// (the first time only; rendering calls this for the method in use)
+extern void InitAntialiasMethod(AntialiasMethod const method);
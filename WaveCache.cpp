@@ -0,0 +1,107 @@
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Wave Table Cache
+*/
+#include "Platform.h"
+
+#include "WaveCache.h"
+
+#if defined(_WIN32)
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+// A cache file holds one generated table after a short header.  Processes
+// that use the same cache directory map the same file, so they share one
+// copy of the table in memory and only the first one builds it.  Tables
+// are saved under a temporary name and renamed into place, so another
+// process never maps a partly written file.
+
+// directory for cached wave tables
+char const *wave_cache_path = NULL;
+
+// wave table cache file header
+struct WaveCacheHeader
+{
+	char magic[8];
+	unsigned long long size;
+};
+static char const wave_cache_magic[8] = { 'M', 'V', 'A', 'S', 'T', 'B', 'L', '1' };
+
+// save data to a cache file and map it
+bool SaveWaveCache(MappedFile &cache, char const *filename, void const *data, size_t const size)
+{
+	// save it under a temporary name and rename it into place
+	// (if another process got there first, use its file instead)
+	char *temporary = static_cast<char *>(malloc(strlen(filename) + 32));
+	sprintf(temporary, "%s.%d.tmp", filename, int(getpid()));
+	if (FILE *file = fopen(temporary, "wb"))
+	{
+		bool const written = fwrite(data, 1, size, file) == size;
+		if (fclose(file) != 0 || !written || rename(temporary, filename) != 0)
+			remove(temporary);
+	}
+	free(temporary);
+
+	// map the saved file
+	if (!cache.Open(filename))
+		return false;
+	if (cache.size != size)
+	{
+		cache.Close();
+		return false;
+	}
+	return true;
+}
+
+// get a wave table from the cache, building and saving it first if needed
+void const *MapWaveCache(MappedFile &cache, char const *name, size_t const size, void (*build)(void *data), void *memory)
+{
+	if (!wave_cache_path)
+	{
+		build(memory);
+		return memory;
+	}
+
+	// cache file name
+	char *filename = static_cast<char *>(malloc(strlen(wave_cache_path) + strlen(name) + 32));
+	sprintf(filename, "%s/%s.cache", wave_cache_path, name);
+
+	// use the cache file if it matches
+	if (cache.Open(filename))
+	{
+		WaveCacheHeader const &header = *static_cast<WaveCacheHeader const *>(cache.data);
+		if (cache.size == sizeof(WaveCacheHeader) + size &&
+			memcmp(header.magic, wave_cache_magic, sizeof(header.magic)) == 0 &&
+			header.size == size)
+		{
+			free(filename);
+			return &header + 1;
+		}
+		cache.Close();
+	}
+
+	// build the table after the cache header
+	WaveCacheHeader *header = static_cast<WaveCacheHeader *>(malloc(sizeof(WaveCacheHeader) + size));
+	memcpy(header->magic, wave_cache_magic, sizeof(header->magic));
+	header->size = size;
+	build(header + 1);
+
+	// save and map the cache file, or keep the table in memory
+	void const *data = NULL;
+	if (SaveWaveCache(cache, filename, header, sizeof(WaveCacheHeader) + size))
+		data = static_cast<WaveCacheHeader const *>(cache.data) + 1;
+	else
+	{
+		fprintf(stderr, "Can't write wave cache file \"%s\"\n", filename);
+		memcpy(memory, header + 1, size);
+		data = memory;
+	}
+	free(header);
+	free(filename);
+	return data;
+}
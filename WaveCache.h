@@ -0,0 +1,27 @@
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Wave Table Cache
+*/
+
+#include "MappedFile.h"
+
+// directory for cached wave tables
+// (NULL to build the tables in memory every time)
+extern char const *wave_cache_path;
+
+// get a wave table from the cache, building and saving it first if needed
+// - name identifies the table and the version of the code that builds it
+// - build fills in size bytes of table data
+// - memory holds the table if there is no cache directory or the cache
+//   file could not be written
+// (returns the table mapped from the cache file, or memory)
+extern void const *MapWaveCache(MappedFile &cache, char const *name, size_t const size, void (*build)(void *data), void *memory);
+
+// save data to a cache file and map it
+// (writes a temporary file and renames it into place, so no process maps
+// a partly written file and mappings of the old file stay valid;
+// returns false if the file could not be written and mapped)
+extern bool SaveWaveCache(MappedFile &cache, char const *filename, void const *data, size_t const size);
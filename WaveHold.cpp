@@ -1,122 +1,152 @@
-#include "StdAfx.h"
-
-#include "Wave.h"
-#include "WaveHold.h"
-#include "PolyBLEP.h"
-#include "Oscillator.h"
-#include "Math.h"
-#include "Random.h"
-
-// precomputed noise wavetable
-float noise[65536];
-
-// initialize noise wavetable
-void InitNoise()
-{
-	for (int i = 0; i < ARRAY_SIZE(noise); ++i)
-	{
-		noise[i] = Random::Float() * 2.0f - 1.0f;
-	}
-}
-
-// shared data oscillator
-static float OscillatorHold(OscillatorConfig const &config, OscillatorState &state, float data[], int cycle, float step)
-{
-	if (step > 0.5f * cycle)
-		return 0;
-
-	// current wavetable value
-	float value = data[state.index];
-#if ANTIALIAS == ANTIALIAS_POLYBLEP
-	if (use_antialias)
-	{
-		float w = Min(step * POLYBLEP_WIDTH, 8.0f);
-
-		int const back = FloorInt(state.phase - w);
-		int const ahead = FloorInt(state.phase + w);
-		int const count = ahead - back;
-		if (count > 0)
-		{
-			int i = state.index + back + cycle;
-			if (i >= cycle)
-				i -= cycle;
-			float t = state.phase - back;
-			float v0 = data[i];
-			for (int c = 0; c < count; ++c)
-			{
-				if (++i >= cycle)
-					i -= cycle;
-				t -= 1.0f;
-				float v1 = data[i];
-				if (v0 != v1)
-					value += PolyBLEP(t, w, v1 - v0);
-				v0 = v1;
-			}
-		}
-	}
-#endif
-	return value;
-}
-
-// shared data oscillator
-static float OscillatorLerp(OscillatorConfig const &config, OscillatorState &state, float data[], int cycle, float step)
-{
-	if (step > 0.5f * cycle)
-		return 0;
-
-	// current and next wavetable value
-	int const index0 = state.index;
-	float const value0 = data[index0];
-	int const index1 = state.index < cycle ? state.index + 1 : 0;
-	float const value1 = data[index1];
-	float value = value0 + (value1 - value0) * state.phase;
-
-#if ANTIALIAS == ANTIALIAS_POLYBLEP
-	if (use_antialias)
-	{
-		float w = Min(step * INTEGRATED_POLYBLEP_WIDTH, 8.0f);
-
-		int const back = FloorInt(state.phase - w);
-		int const ahead = FloorInt(state.phase + w);
-		int const count = ahead - back;
-		if (count > 0)
-		{
-			int i = index0 + back + cycle;
-			if (i >= cycle)
-				i -= cycle;
-			float const vn1 = data[i];
-			if (++i >= cycle)
-				i -= cycle;
-			float t = state.phase - back;
-			float v0 = data[i];
-			float s0 = v0 - vn1;
-			for (int c = 0; c < count; ++c)
-			{
-				if (++i >= cycle)
-					i -= cycle;
-				t -= 1.0f;
-				float const v1 = data[i];
-				float const s1 = v1 - v0;
-				if (s0 != s1)
-					value += IntegratedPolyBLEP(t, w, s1 - s0);
-				v0 = v1;
-				s0 = s1;
-			}
-		}
-	}
-#endif
-	return value;
-}
-
-
-// sample-and-hold noise
-float OscillatorNoiseHold(OscillatorConfig const &config, OscillatorState &state, float step)
-{
-	return OscillatorHold(config, state, noise, ARRAY_SIZE(noise), step);
-}
-
-// linear interpolated noise
-float OscillatorNoiseSlope(OscillatorConfig const &config, OscillatorState &state, float step)
-{
-	return OscillatorLerp(config, state, noise, ARRAY_SIZE(noise), step);
-}
+#include "Platform.h"
+
+#include "Wave.h"
+#include "WaveHold.h"
+#include "PolyBLEP.h"
+#include "Oscillator.h"
+#include "OscillatorKernel.h"
+#include "Math.h"
+#include "Random.h"
+
+// precomputed noise wavetable
+float noise[65536];
+
+// entries past the end of an edge table
+// (the most steps a PolyBLEP scan window covers)
+#define HOLD_EDGE_GUARD 16
+
+// precomputed noise wavetable edges
+// (entry i is the step from noise value i to the next one, repeating past
+// the end so a scan window never wraps)
+static float noise_edge[ARRAY_SIZE(noise) + HOLD_EDGE_GUARD];
+
+// initialize noise wavetable
+// (from a fixed seed, so the table is the same whenever it gets built)
+void InitNoise()
+{
+	unsigned int seed = 0x92D68CA2;
+	for (int i = 0; i < int(ARRAY_SIZE(noise)); ++i)
+	{
+		noise[i] = Random::Float(seed) * 2.0f - 1.0f;
+	}
+	for (int i = 0; i < int(ARRAY_SIZE(noise_edge)); ++i)
+	{
+		noise_edge[i] = noise[(i + 1) % ARRAY_SIZE(noise)] - noise[i % ARRAY_SIZE(noise)];
+	}
+}
+
+// shared data oscillator
+// (edge holds the step after each data value; see noise_edge)
+template<bool ANTIALIASED> static __forceinline float OscillatorHold(OscillatorConfig const &, OscillatorState &state, float const data[], float const edge[], int cycle, float step)
+{
+	if (step > 0.5f * cycle)
+		return 0;
+
+	// current wavetable value
+	float value = data[state.index];
+#if ANTIALIAS == ANTIALIAS_POLYBLEP
+	if (ANTIALIASED)
+	{
+		float w = Min(step * POLYBLEP_WIDTH, 8.0f);
+
+		int const back = FloorInt(state.phase - w);
+		int const ahead = FloorInt(state.phase + w);
+		int const count = ahead - back;
+		if (count > 0)
+		{
+			int i = state.index + back + cycle;
+			if (i >= cycle)
+				i -= cycle;
+
+			// edges from back to ahead
+			// (a step without an edge adds nothing, so there is no test)
+			float t = state.phase - back;
+			for (int c = 0; c < count; ++c)
+			{
+				t -= 1.0f;
+				value += PolyBLEP(t, w, edge[i + c]);
+			}
+		}
+	}
+#endif
+	return value;
+}
+
+// shared data oscillator
+template<bool ANTIALIASED> static __forceinline float OscillatorLerp(OscillatorConfig const &, OscillatorState &state, float data[], int cycle, float step)
+{
+	if (step > 0.5f * cycle)
+		return 0;
+
+	// current and next wavetable value
+	int const index0 = state.index;
+	float const value0 = data[index0];
+	int const index1 = state.index + 1 < cycle ? state.index + 1 : 0;
+	float const value1 = data[index1];
+	float value = value0 + (value1 - value0) * state.phase;
+
+#if ANTIALIAS == ANTIALIAS_POLYBLEP
+	if (ANTIALIASED)
+	{
+		float w = Min(step * INTEGRATED_POLYBLEP_WIDTH, 8.0f);
+
+		int const back = FloorInt(state.phase - w);
+		int const ahead = FloorInt(state.phase + w);
+		int const count = ahead - back;
+		if (count > 0)
+		{
+			int i = index0 + back + cycle;
+			if (i >= cycle)
+				i -= cycle;
+			float const vn1 = data[i];
+			if (++i >= cycle)
+				i -= cycle;
+			float t = state.phase - back;
+			float v0 = data[i];
+			float s0 = v0 - vn1;
+			for (int c = 0; c < count; ++c)
+			{
+				if (++i >= cycle)
+					i -= cycle;
+				t -= 1.0f;
+				float const v1 = data[i];
+				float const s1 = v1 - v0;
+				if (s0 != s1)
+					value += IntegratedPolyBLEP(t, w, s1 - s0);
+				v0 = v1;
+				s0 = s1;
+			}
+		}
+	}
+#endif
+	return value;
+}
+
+
+// sample-and-hold noise
+template<bool ANTIALIASED, bool SYNC> static __forceinline float EvaluateNoiseHold(OscillatorConfig const &config, OscillatorState &state, float step)
+{
+	return OscillatorHold<ANTIALIASED>(config, state, noise, noise_edge, ARRAY_SIZE(noise), step);
+}
+float OscillatorNoiseHold(OscillatorConfig const &config, OscillatorState &state, float step)
+{
+	if (use_antialias)
+		return EvaluateNoiseHold<true, false>(config, state, step);
+	return EvaluateNoiseHold<false, false>(config, state, step);
+}
+
+// linear interpolated noise
+template<bool ANTIALIASED, bool SYNC> static __forceinline float EvaluateNoiseSlope(OscillatorConfig const &config, OscillatorState &state, float step)
+{
+	return OscillatorLerp<ANTIALIASED>(config, state, noise, ARRAY_SIZE(noise), step);
+}
+float OscillatorNoiseSlope(OscillatorConfig const &config, OscillatorState &state, float step)
+{
+	if (use_antialias)
+		return EvaluateNoiseSlope<true, false>(config, state, step);
+	return EvaluateNoiseSlope<false, false>(config, state, step);
+}
+
+// noise wave kernels
+WaveRender const noise_hold_render[2][2][2] = OSCILLATOR_KERNELS(EvaluateNoiseHold);
+WaveRender const noise_slope_render[2][2][2] = OSCILLATOR_KERNELS(EvaluateNoiseSlope);
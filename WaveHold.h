@@ -1,11 +1,16 @@
-#pragma once
-
-// precomputed noise wavetable
-extern float noise[65536];
-
-// initialize noise wavetable
-extern void InitNoise();
-
-// sample-and-hold noise
-extern float OscillatorNoiseHold(OscillatorConfig const &config, OscillatorState &state, float step);
-extern float OscillatorNoiseSlope(OscillatorConfig const &config, OscillatorState &state, float step);
+#pragma once
+
+// precomputed noise wavetable
+extern float noise[65536];
+
+// initialize noise wavetable
+extern void InitNoise();
+
+// sample-and-hold noise
+extern float OscillatorNoiseHold(OscillatorConfig const &config, OscillatorState &state, float step);
+extern float OscillatorNoiseSlope(OscillatorConfig const &config, OscillatorState &state, float step);
+
+// noise wave kernels
+// (indexed by antialiasing, hard sync, and sub-oscillator)
+extern WaveRender const noise_hold_render[2][2][2];
+extern WaveRender const noise_slope_render[2][2][2];
@@ -1,155 +1,226 @@
-/*
-MINI VIRTUAL ANALOG SYNTHESIZER
-Copyright 2014 Kenneth D. Miller III
-
-White Noise
-*/
-#include "StdAfx.h"
-
-#include "Random.h"
-#include "WaveNoise.h"
-#include "Oscillator.h"
-#include "Math.h"
-
-// http://www.firstpr.com.au/dsp/pink-noise/
-//b0 = 0.99765f * b0 + white * 0.0990460f;	// x42.147234f
-//b1 = 0.96300f * b1 + white * 0.2965164f;	// x8.013957f
-//b2 = 0.57000f * b2 + white * 1.0526913f;	// x2.448119f
-//float const pink = 0.25f * (b0 + b1 + b2 + white * 0.1848f);
-
-#define FILTERS 3
-
-// low-pass filter bank for colored noise
-#if FILTERS == 3
-static const float a[3] =
-{
-	1 - 0.997907817f,	// 1 - expf(-2 * M_PI * 16 / 48000);
-	1 - 0.967044930f,	// 1 - expf(-2 * M_PI * 256 / 48000);
-	1 - 0.584987297f,	// 1 - expf(-2 * M_PI * 4096 / 48000);
-};
-static const float falloff = 0.25;	// sqrtf(1.f / 16.0f)
-static float const w0 = 1 - falloff;
-static float const w1 = w0 * falloff;
-static float const w2 = w1 * falloff;
-static const float w3 = falloff - w1 - w2;
-#elif FILTERS == 4
-static const float a[4] =
-{
-	1 - 0.997907817f,	// 1 - expf(-2 * M_PI * 16 / 48000);
-	1 - 0.983384430f,	// 1 - expf(-2 * M_PI * 128 / 48000);
-	1 - 0.874553978f,	// 1 - expf(-2 * M_PI * 1024 / 48000);
-	1 - 0.342210114f,	// 1 - expf(-2 * M_PI * 8192 / 48000);
-};
-static const float falloff = 0.353553385f;	// sqrtf(1.f / 8.f);
-static float const w0 = 1 - falloff;
-static float const w1 = w0 * falloff;
-static float const w2 = w1 * falloff;
-static float const w3 = w2 * falloff;
-static float const w4 = falloff - w1 - w2 - w3;
-#elif FILTERS == 5
-static const float a[5] =
-{
-	1 - 0.997907817f,	// 1 - expf(-2 * M_PI * 16 / 48000);
-	1 - 0.991657414f,	// 1 - expf(-2 * M_PI * 64 / 48000);
-	1 - 0.967044930f,	// 1 - expf(-2 * M_PI * 256 / 48000);
-	1 - 0.874553978f,	// 1 - expf(-2 * M_PI * 1024 / 48000);
-	1 - 0.584987297f,	// 1 - expf(-2 * M_PI * 4096 / 48000);
-};
-static const float falloff = 0.25f;	//sqrtf(1.f / 4.f);
-static float const w0 = 1 - falloff;
-static float const w1 = w0 * falloff;
-static float const w2 = w1 * falloff;
-static float const w3 = w2 * falloff;
-static float const w4 = w3 * falloff;
-static float const w5 = falloff - w1 - w2 - w3 - w4;
-#endif
-
-// noise wave
-float OscillatorNoise(OscillatorConfig const &config, OscillatorState &state, float step)
-{
-#if 1
-	// whte noise
-	float white = Random::Float() * 2.0f - 1.0f;
-
-	// if generating pure white noise, return that
-	if (config.waveparam == 0.5f)
-		return white;
-
-	float param = config.waveparam;
-
-	// low-pass filter bank
-	for (int i = 0; i < FILTERS; ++i)
-		state.f[i] += (white - state.f[i]) * a[i];
-
-
-	// desired spectral tilt:
-	// param=0.00 red -6dB/oct
-	// param=0.25 pink -3dB/oct, 
-	// param=0.50 white 0dB/oct
-	// param=0.75 blue +3dB/oct
-	// param=1.00 violet +6dB/oct
-
-	// if generating red/pink...
-	if (config.waveparam < 0.5f)
-	{
-		// -3dB/oct pink noise
-#if FILTERS == 3
-		float const pink = 8 * (w0 * state.f[0] + w1 * state.f[1] + w2 * state.f[2] + w3 * white);
-#elif FILTERS == 4
-		float const pink = 8 * (w0 * state.f[0] + w1 * state.f[1] + w2 * state.f[2] + w3 * state.f[3] + w4 * white);
-#elif FILTERS == 5
-		float const pink = 8 * (w0 * state.f[0] + w1 * state.f[1] + w2 * state.f[2] + w3 * state.f[3] + w2 * state.f[4] + w5 * white);
-#endif
-
-		// if generating pure pink noise, return that
-		if (param == 0.25f)
-			return pink;
-
-		if (param < 0.25)
-		{
-			// -6dB/oct red noise
-			float const red = 16 * state.f[0];
-
-			// blend between red and pink
-			float const s = param * 4;
-			return red + (pink - red) * s;
-		}
-		else
-		{
-			// bend between white and pink
-			float const s = param * 4 - 1;
-			return pink + (white - pink) * s;
-		}
-	}
-	else
-	{
-		// +3dB/oct blue noise
-#if FILTERS == 3
-		float const blue = 2 * (white - w2 * state.f[0] - w1 * state.f[1] - w0 * state.f[2]);
-#elif FILTERS == 4
-		float const blue = 2 * (white - w3 * state.f[0] - w2 * state.f[1] - w1 * state.f[2] - w0 * state.f[3]);
-#elif FILTERS == 5
-		float const blue = 2 * (white - w4 * state.f[0] - w3 * state.f[1] - w2 * state.f[2] - w1 * state.f[3] - w0 * state.f[4]);
-#endif
-
-		if (param < 0.75f)
-		{
-			// blend between white and blue
-			float const s = param * 4 - 2;
-			return white + (blue - white) * s;
-		}
-		else
-		{
-			// +6dB/oct violet noise
-			float const violet = 1.41421356f *(white - state.f[FILTERS]);
-			state.f[FILTERS] = white;
-
-			// blend between blue and violet
-			float const s = param * 4 - 3;
-			return blue + (violet - blue) * s;
-		}
-	}
-#else
-	return Random::Float() * 2.0f - 1.0f;
-#endif
-}
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+White Noise
+*/
+#include "Platform.h"
+
+#include "Random.h"
+#include "Wave.h"
+#include "WaveNoise.h"
+#include "Oscillator.h"
+#include "OscillatorKernel.h"
+#include "Math.h"
+#include "SIMD.h"
+
+// http://www.firstpr.com.au/dsp/pink-noise/
+//b0 = 0.99765f * b0 + white * 0.0990460f;	// x42.147234f
+//b1 = 0.96300f * b1 + white * 0.2965164f;	// x8.013957f
+//b2 = 0.57000f * b2 + white * 1.0526913f;	// x2.448119f
+//float const pink = 0.25f * (b0 + b1 + b2 + white * 0.1848f);
+
+#define FILTERS 3
+
+// low-pass filter bank for colored noise
+#if FILTERS == 3
+static const float a[3] =
+{
+	1 - 0.997907817f,	// 1 - expf(-2 * M_PI * 16 / 48000);
+	1 - 0.967044930f,	// 1 - expf(-2 * M_PI * 256 / 48000);
+	1 - 0.584987297f,	// 1 - expf(-2 * M_PI * 4096 / 48000);
+};
+static const float falloff = 0.25;	// sqrtf(1.f / 16.0f)
+static float const w0 = 1 - falloff;
+static float const w1 = w0 * falloff;
+static float const w2 = w1 * falloff;
+static const float w3 = falloff - w1 - w2;
+#elif FILTERS == 4
+static const float a[4] =
+{
+	1 - 0.997907817f,	// 1 - expf(-2 * M_PI * 16 / 48000);
+	1 - 0.983384430f,	// 1 - expf(-2 * M_PI * 128 / 48000);
+	1 - 0.874553978f,	// 1 - expf(-2 * M_PI * 1024 / 48000);
+	1 - 0.342210114f,	// 1 - expf(-2 * M_PI * 8192 / 48000);
+};
+static const float falloff = 0.353553385f;	// sqrtf(1.f / 8.f);
+static float const w0 = 1 - falloff;
+static float const w1 = w0 * falloff;
+static float const w2 = w1 * falloff;
+static float const w3 = w2 * falloff;
+static float const w4 = falloff - w1 - w2 - w3;
+#elif FILTERS == 5
+static const float a[5] =
+{
+	1 - 0.997907817f,	// 1 - expf(-2 * M_PI * 16 / 48000);
+	1 - 0.991657414f,	// 1 - expf(-2 * M_PI * 64 / 48000);
+	1 - 0.967044930f,	// 1 - expf(-2 * M_PI * 256 / 48000);
+	1 - 0.874553978f,	// 1 - expf(-2 * M_PI * 1024 / 48000);
+	1 - 0.584987297f,	// 1 - expf(-2 * M_PI * 4096 / 48000);
+};
+static const float falloff = 0.25f;	//sqrtf(1.f / 4.f);
+static float const w0 = 1 - falloff;
+static float const w1 = w0 * falloff;
+static float const w2 = w1 * falloff;
+static float const w3 = w2 * falloff;
+static float const w4 = w3 * falloff;
+static float const w5 = falloff - w1 - w2 - w3 - w4;
+#endif
+
+// colored noise from white noise
+// (T is float, or SIMDFloat for a group of oscillators; f holds the
+// filter bank state)
+template<typename T> static __forceinline T ColorNoise(float const param, T const white, T f[])
+{
+	// if generating pure white noise, return that
+	if (param == 0.5f)
+		return white;
+
+	// low-pass filter bank
+	for (int i = 0; i < FILTERS; ++i)
+		f[i] = f[i] + (white - f[i]) * T(a[i]);
+
+
+	// desired spectral tilt:
+	// param=0.00 red -6dB/oct
+	// param=0.25 pink -3dB/oct, 
+	// param=0.50 white 0dB/oct
+	// param=0.75 blue +3dB/oct
+	// param=1.00 violet +6dB/oct
+
+	// if generating red/pink...
+	if (param < 0.5f)
+	{
+		// -3dB/oct pink noise
+#if FILTERS == 3
+		T const pink = T(8.0f) * (T(w0) * f[0] + T(w1) * f[1] + T(w2) * f[2] + T(w3) * white);
+#elif FILTERS == 4
+		T const pink = T(8.0f) * (T(w0) * f[0] + T(w1) * f[1] + T(w2) * f[2] + T(w3) * f[3] + T(w4) * white);
+#elif FILTERS == 5
+		T const pink = T(8.0f) * (T(w0) * f[0] + T(w1) * f[1] + T(w2) * f[2] + T(w3) * f[3] + T(w2) * f[4] + T(w5) * white);
+#endif
+
+		// if generating pure pink noise, return that
+		if (param == 0.25f)
+			return pink;
+
+		if (param < 0.25)
+		{
+			// -6dB/oct red noise
+			T const red = T(16.0f) * f[0];
+
+			// blend between red and pink
+			float const s = param * 4;
+			return red + (pink - red) * T(s);
+		}
+		else
+		{
+			// bend between white and pink
+			float const s = param * 4 - 1;
+			return pink + (white - pink) * T(s);
+		}
+	}
+	else
+	{
+		// +3dB/oct blue noise
+#if FILTERS == 3
+		T const blue = T(2.0f) * (white - T(w2) * f[0] - T(w1) * f[1] - T(w0) * f[2]);
+#elif FILTERS == 4
+		T const blue = T(2.0f) * (white - T(w3) * f[0] - T(w2) * f[1] - T(w1) * f[2] - T(w0) * f[3]);
+#elif FILTERS == 5
+		T const blue = T(2.0f) * (white - T(w4) * f[0] - T(w3) * f[1] - T(w2) * f[2] - T(w1) * f[3] - T(w0) * f[4]);
+#endif
+
+		if (param < 0.75f)
+		{
+			// blend between white and blue
+			float const s = param * 4 - 2;
+			return white + (blue - white) * T(s);
+		}
+		else
+		{
+			// +6dB/oct violet noise
+			T const violet = T(1.41421356f) * (white - f[FILTERS]);
+			f[FILTERS] = white;
+
+			// blend between blue and violet
+			float const s = param * 4 - 3;
+			return blue + (violet - blue) * T(s);
+		}
+	}
+}
+
+// noise wave
+template<bool ANTIALIASED, bool SYNC> static __forceinline float EvaluateNoise(OscillatorConfig const &config, OscillatorState &state, float /*step*/)
+{
+	// white noise
+	// (the next value of the oscillator's random stream)
+	float const white = Random::Unit(Random::Counter(state.seed, state.counter++)) * 2.0f - 1.0f;
+
+	return ColorNoise(config.waveparam, white, state.f);
+}
+
+// noise wave
+// (flags tested at run time; see noise_render for block rendering)
+float OscillatorNoise(OscillatorConfig const &config, OscillatorState &state, float step)
+{
+	return EvaluateNoise<false, false>(config, state, step);
+}
+
+// noise wave kernels
+WaveRender const noise_render[2][2][2] = OSCILLATOR_KERNELS(EvaluateNoise);
+
+// noise wave for a group of oscillators
+// (same as OscillatorNoise: each lane generates its own random stream
+// and filters it with its own filter bank)
+static void OscillatorNoiseGroup(OscillatorConfig const &config, OscillatorGroup &group, size_t count)
+{
+	// random stream and filter bank state for each lane
+	SIMD_ALIGN unsigned int k[SIMD_WIDTH], c[SIMD_WIDTH];
+	SIMD_ALIGN float s[FILTERS + 1][SIMD_WIDTH];
+	for (int lane = 0; lane < SIMD_WIDTH; ++lane)
+	{
+		OscillatorState const &state = *group.state[lane];
+		k[lane] = state.seed;
+		c[lane] = state.counter;
+		for (int i = 0; i <= FILTERS; ++i)
+			s[i][lane] = state.f[i];
+	}
+	SIMDInt const key = SIMDInt::Load(k);
+	SIMDInt counter = SIMDInt::Load(c);
+	SIMDFloat f[FILTERS + 1];
+	for (int i = 0; i <= FILTERS; ++i)
+		f[i] = SIMDFloat::Load(s[i]);
+
+	SIMDFloat amplitude(config.amplitude);
+	SIMDFloat const amplitude_step(config.amplitude_step);
+	float waveparam = config.waveparam;
+	for (size_t i = 0; i < count; ++i)
+	{
+		// white noise
+		// (the same conversion as Random::Unit)
+		SIMDInt const bits = Random::Counter(key, counter);
+		counter = counter + SIMDInt(1U);
+		SIMDFloat const unit = AsFloat((bits >> 9) | SIMDInt(0x3f800000U)) - SIMDFloat(1.0f);
+		SIMDFloat const white = unit * SIMDFloat(2.0f) - SIMDFloat(1.0f);
+
+		group.Accumulate(i, amplitude * ColorNoise(waveparam, white, f));
+		amplitude = amplitude + amplitude_step;
+		waveparam += config.waveparam_step;
+		group.Advance();
+	}
+
+	counter.Store(c);
+	for (int i = 0; i <= FILTERS; ++i)
+		f[i].Store(s[i]);
+	for (int lane = 0; lane < SIMD_WIDTH; ++lane)
+	{
+		OscillatorState &state = *group.state[lane];
+		state.counter = c[lane];
+		for (int i = 0; i <= FILTERS; ++i)
+			state.f[i] = s[i][lane];
+	}
+}
+
+// noise wave group functions
+WaveRenderGroup const noise_render_group[2] = { OscillatorNoiseGroup, OscillatorNoiseGroup };
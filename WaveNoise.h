@@ -1,12 +1,21 @@
-#pragma once
-/*
-MINI VIRTUAL ANALOG SYNTHESIZER
-Copyright 2014 Kenneth D. Miller III
-
-White Noise
-*/
-
-class OscillatorConfig;
-class OscillatorState;
-
-float OscillatorNoise(OscillatorConfig const &config, OscillatorState &state, float step);
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+White Noise
+*/
+
+class OscillatorConfig;
+class OscillatorState;
+class OscillatorGroup;
+
+float OscillatorNoise(OscillatorConfig const &config, OscillatorState &state, float step);
+
+// noise wave kernels
+// (indexed by antialiasing, hard sync, and sub-oscillator)
+extern WaveRender const noise_render[2][2][2];
+
+// noise wave group functions
+// (indexed by antialiasing)
+extern WaveRenderGroup const noise_render_group[2];
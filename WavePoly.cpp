@@ -1,167 +1,324 @@
-/*
-MINI VIRTUAL ANALOG SYNTHESIZER
-Copyright 2014 Kenneth D. Miller III
-
-Poly-Noise Wave
-*/
-#include "StdAfx.h"
-
-#include "Wave.h"
-#include "WavePoly.h"
-#include "Oscillator.h"
-#include "PolyBLEP.h"
-#include "Math.h"
-
-// precomputed linear feedback shift register output
-char poly4[(1 << 4) - 1];
-char poly5[(1 << 5) - 1];
-char period93[93];
-char poly9[(1 << 9) - 1];
-char poly17[(1 << 17) - 1];
-
-// precomputed wave tables for poly5-clocked waveforms
-char pulsepoly5[ARRAY_SIZE(poly5) * 2];
-char poly4poly5[ARRAY_SIZE(poly5) * ARRAY_SIZE(poly4)];
-char poly17poly5[ARRAY_SIZE(poly5) * ARRAY_SIZE(poly17)];
-
-static char const * const poly_data[WAVE_COUNT] =
-{
-	NULL,			// WAVE_SINE,
-	NULL,			// WAVE_PULSE,
-	NULL,			// WAVE_SAWTOOTH,
-	NULL,			// WAVE_TRIANGLE,
-	NULL,			// WAVE_NOISE,
-	NULL,			// WAVE_NOISE_HOLD,
-	NULL,			// WAVE_NOISE_SLOPE,
-	poly4,			// WAVE_POLY4,
-	poly5,			// WAVE_POLY5,
-	period93,		// WAVE_PERIOD93,
-	poly9,			// WAVE_POLY9,
-	poly17,			// WAVE_POLY17,
-	pulsepoly5,		// WAVE_PULSE_POLY5,
-	poly4poly5,		// WAVE_POLY4_POLY5,
-	poly17poly5,	// WAVE_POLY17_POLY5,
-};
-
-// generate polynomial table
-// from Atari800 pokey.c
-static void InitPoly(char aOut[], int aSize, int aTap, unsigned int aSeed, char aInvert)
-{
-	unsigned int x = aSeed;
-	unsigned int i = 0;
-	do
-	{
-		aOut[i] = (x & 1) ^ aInvert;
-		x = ((((x >> aTap) ^ x) & 1) << (aSize - 1)) | (x >> 1);
-		++i;
-	}
-	while (x != aSeed);
-}
-
-// generate pulsepoly5 table
-static void InitPulsePoly5()
-{
-	char output = 0;
-	int index5 = 0;
-	for (int i = 0; i < ARRAY_SIZE(pulsepoly5); ++i)
-	{
-		if (poly5[index5])
-			output = !output;
-		pulsepoly5[i] = output;
-		if (++index5 == ARRAY_SIZE(poly5))
-			index5 = 0;
-	}
-}
-
-// generate poly4poly5 table
-static void InitPoly4Poly5()
-{
-	char output = 0;
-	int index5 = 0;
-	int index4 = 0;
-	for (int i = 0; i < ARRAY_SIZE(poly4poly5); ++i)
-	{
-		if (++index4 == ARRAY_SIZE(poly4))
-			index4 = 0;
-		if (poly5[index5])
-			output = poly4[index4];
-		poly4poly5[i] = output;
-		if (++index5 == ARRAY_SIZE(poly5))
-			index5 = 0;
-	}
-}
-
-// generate poly17poly5 table
-static void InitPoly17Poly5()
-{
-	char output = 0;
-	int index5 = 0;
-	int index17 = 0;
-	for (int i = 0; i < ARRAY_SIZE(poly17poly5); ++i)
-	{
-		if (++index17 == ARRAY_SIZE(poly17))
-			index17 = 0;
-		if (poly5[index5])
-			output = poly17[index17];
-		poly17poly5[i] = output;
-		if (++index5 == ARRAY_SIZE(poly5))
-			index5 = 0;
-	}
-}
-
-// initialize polynomial noise tables
-void InitPoly()
-{
-	InitPoly(poly4, 4, 1, 0xF, 0);
-	InitPoly(poly5, 5, 2, 0x1F, 1);
-	InitPoly(period93, 15, 6, 0x7FFF, 0);
-	InitPoly(poly9, 9, 4, 0x1FF, 0);
-	InitPoly(poly17, 17, 5, 0x1FFFF, 0);
-	InitPulsePoly5();
-	InitPoly4Poly5();
-	InitPoly17Poly5();
-}
-
-// shared poly oscillator
-float OscillatorPoly(OscillatorConfig const &config, OscillatorState &state, float step)
-{
-	// poly info for the wave type
-	int const cycle = wave_loop_cycle[config.wavetype];
-	if (step > 0.5f * cycle)
-		return 0;
-
-	// current wavetable value
-	char const * const poly = poly_data[config.wavetype];
-	float value = poly[state.index];
-
-#if ANTIALIAS == ANTIALIAS_POLYBLEP
-	if (use_antialias)
-	{
-		float w = Min(step * POLYBLEP_WIDTH, 8.0f);
-
-		int const back = FloorInt(state.phase - w);
-		int const ahead = FloorInt(state.phase + w);
-		int const count = ahead - back;
-		if (count > 0)
-		{
-			int i = state.index + back + cycle;
-			if (i >= cycle)
-				i -= cycle;
-			float t = state.phase - back;
-			char v0 = poly[i];
-			for (int c = 0; c < count; ++c)
-			{
-				if (++i >= cycle)
-					i -= cycle;
-				t -= 1.0f;
-				char v1 = poly[i];
-				if (v0 != v1)
-					value += PolyBLEP(t, w, float(v1 - v0));
-				v0 = v1;
-			}
-		}
-	}
-#endif
-
-	return value + value - 1.0f;
-}
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Poly-Noise Wave
+*/
+#include "Platform.h"
+
+#include "Wave.h"
+#include "WavePoly.h"
+#include "Oscillator.h"
+#include "OscillatorKernel.h"
+#include "PolyBLEP.h"
+#include "WaveCache.h"
+#include "Math.h"
+
+// precomputed linear feedback shift register output
+unsigned int poly4[POLY_WORDS(POLY4_LENGTH)];
+unsigned int poly5[POLY_WORDS(POLY5_LENGTH)];
+unsigned int period93[POLY_WORDS(PERIOD93_LENGTH)];
+unsigned int poly9[POLY_WORDS(POLY9_LENGTH)];
+unsigned int poly17[POLY_WORDS(POLY17_LENGTH)];
+
+// precomputed wave tables for poly5-clocked waveforms
+unsigned int pulsepoly5[POLY_WORDS(PULSE_POLY5_LENGTH)];
+#if POLY_CLOCKED == POLY_CLOCKED_TABLE
+// (unused if the tables are mapped from the wave cache)
+static unsigned int poly4poly5[POLY_WORDS(POLY4_POLY5_LENGTH)];
+static unsigned int poly17poly5[POLY_WORDS(POLY17_POLY5_LENGTH)];
+
+// wave cache files for poly5-clocked waveforms
+static MappedFile poly4poly5_cache;
+static MappedFile poly17poly5_cache;
+#endif
+
+// tables in use for each poly wave type
+static unsigned int const *poly_data[WAVE_COUNT] =
+{
+	NULL,			// WAVE_SINE,
+	NULL,			// WAVE_PULSE,
+	NULL,			// WAVE_SAWTOOTH,
+	NULL,			// WAVE_TRIANGLE,
+	NULL,			// WAVE_NOISE,
+	NULL,			// WAVE_NOISE_HOLD,
+	NULL,			// WAVE_NOISE_SLOPE,
+	poly4,			// WAVE_POLY4,
+	poly5,			// WAVE_POLY5,
+	period93,		// WAVE_PERIOD93,
+	poly9,			// WAVE_POLY9,
+	poly17,			// WAVE_POLY17,
+	pulsepoly5,		// WAVE_PULSE_POLY5,
+#if POLY_CLOCKED == POLY_CLOCKED_TABLE
+	poly4poly5,		// WAVE_POLY4_POLY5,
+	poly17poly5,	// WAVE_POLY17_POLY5,
+#else
+	NULL,			// WAVE_POLY4_POLY5,
+	NULL,			// WAVE_POLY17_POLY5,
+#endif
+	NULL,			// WAVE_TABLE,
+};
+
+// one step of a bit-packed sequence
+static __forceinline int GetPolyBit(unsigned int const poly[], int const i)
+{
+	return (poly[i >> 5] >> (i & 31)) & 1;
+}
+
+// set one step of a bit-packed sequence
+static void SetPolyBit(unsigned int poly[], int const i, int const bit)
+{
+	poly[i >> 5] = (poly[i >> 5] & ~(1U << (i & 31))) | (unsigned(bit) << (i & 31));
+}
+
+// repeat the start of a bit-packed sequence past its end
+// (so a window starting anywhere in the sequence needs no wrap)
+static void RepeatPoly(unsigned int poly[], int const length)
+{
+	for (int i = length; i < (length + 63) / 32 * 32 + 32; ++i)
+		SetPolyBit(poly, i, GetPolyBit(poly, i - length));
+}
+
+// 32 steps of a bit-packed sequence starting at step i
+// (step i in the low bit)
+static __forceinline unsigned int GetPolyWindow(unsigned int const poly[], int const i)
+{
+	unsigned long long const pair = ((unsigned long long)(poly[(i >> 5) + 1]) << 32) | poly[i >> 5];
+	return unsigned(pair >> (i & 31));
+}
+
+// generate polynomial table
+// from Atari800 pokey.c
+static void InitPoly(unsigned int aOut[], int aSize, int aTap, unsigned int aSeed, char aInvert)
+{
+	unsigned int x = aSeed;
+	unsigned int i = 0;
+	do
+	{
+		SetPolyBit(aOut, i, (x & 1) ^ aInvert);
+		x = ((((x >> aTap) ^ x) & 1) << (aSize - 1)) | (x >> 1);
+		++i;
+	}
+	while (x != aSeed);
+	RepeatPoly(aOut, i);
+}
+
+// generate pulsepoly5 table
+static void InitPulsePoly5()
+{
+	char output = 0;
+	int index5 = 0;
+	for (int i = 0; i < PULSE_POLY5_LENGTH; ++i)
+	{
+		if (GetPolyBit(poly5, index5))
+			output = !output;
+		SetPolyBit(pulsepoly5, i, output);
+		if (++index5 == POLY5_LENGTH)
+			index5 = 0;
+	}
+	RepeatPoly(pulsepoly5, PULSE_POLY5_LENGTH);
+}
+
+#if POLY_CLOCKED == POLY_CLOCKED_TABLE
+// generate a poly5-clocked table
+// (each step holds the source output at the last step the poly5 output
+// was set, packing a word at a time)
+static void InitClockedPoly(unsigned int table[], unsigned int const source[], int const length)
+{
+	int const cycle = length * POLY5_LENGTH;
+	char output = 0;
+	int index5 = 0;
+	int index = 0;
+	unsigned int word = 0;
+	for (int i = 0; i < cycle; ++i)
+	{
+		if (++index == length)
+			index = 0;
+		if (GetPolyBit(poly5, index5))
+			output = GetPolyBit(source, index);
+		word |= unsigned(output) << (i & 31);
+		if ((i & 31) == 31)
+		{
+			table[i >> 5] = word;
+			word = 0;
+		}
+		if (++index5 == POLY5_LENGTH)
+			index5 = 0;
+	}
+	table[cycle >> 5] = word;
+	RepeatPoly(table, cycle);
+}
+
+// generate poly4poly5 table
+static void InitPoly4Poly5(void *data)
+{
+	InitClockedPoly(static_cast<unsigned int *>(data), poly4, POLY4_LENGTH);
+}
+
+// generate poly17poly5 table
+static void InitPoly17Poly5(void *data)
+{
+	InitClockedPoly(static_cast<unsigned int *>(data), poly17, POLY17_LENGTH);
+}
+#else
+// steps of a poly5-clocked sequence computed from its source sequence
+// - step i holds source step (j + 1) % length for the last step j <= i
+//   where poly5 step j % 31 is set
+// - steps before the first clock in the cycle hold 0
+// (the same as the table InitPoly4Poly5 or InitPoly17Poly5 would build;
+// returns count steps starting at step i with step i in the low bit)
+static __forceinline unsigned int GetClockedPolyWindow(unsigned int const source[], int const length, int const cycle, int i, int const count)
+{
+	// find the last clock at or before the first step
+	int index5 = i % POLY5_LENGTH;
+	int j = i;
+	while (j >= 0 && !GetPolyBit(poly5, index5))
+	{
+		--j;
+		index5 = index5 ? index5 - 1 : POLY5_LENGTH - 1;
+	}
+	unsigned int output = j >= 0 ? GetPolyBit(source, (j + 1) % length) : 0;
+	unsigned int window = output;
+
+	// follow the clock through the rest of the steps
+	index5 = i % POLY5_LENGTH;
+	int index = (i + 1) % length;
+	for (int c = 1; c < count; ++c)
+	{
+		if (++i == cycle)
+		{
+			// the sequence restarts unclocked
+			i = 0;
+			output = 0;
+		}
+		if (++index5 == POLY5_LENGTH)
+			index5 = 0;
+		if (++index == length)
+			index = 0;
+		if (GetPolyBit(poly5, index5))
+			output = GetPolyBit(source, index);
+		window |= output << c;
+	}
+	return window;
+}
+#endif
+
+// build the tables a poly wave type uses
+// (each table once)
+void InitPoly(Wave const wavetype)
+{
+	static bool built[WAVE_COUNT];
+	if (built[wavetype])
+		return;
+	built[wavetype] = true;
+
+	switch (wavetype)
+	{
+	case WAVE_POLY4:
+		InitPoly(poly4, 4, 1, 0xF, 0);
+		break;
+	case WAVE_POLY5:
+		InitPoly(poly5, 5, 2, 0x1F, 1);
+		break;
+	case WAVE_PERIOD93:
+		InitPoly(period93, 15, 6, 0x7FFF, 0);
+		break;
+	case WAVE_POLY9:
+		InitPoly(poly9, 9, 4, 0x1FF, 0);
+		break;
+	case WAVE_POLY17:
+		InitPoly(poly17, 17, 5, 0x1FFFF, 0);
+		break;
+	case WAVE_PULSE_POLY5:
+		InitPoly(WAVE_POLY5);
+		InitPulsePoly5();
+		break;
+	case WAVE_POLY4_POLY5:
+		InitPoly(WAVE_POLY4);
+		InitPoly(WAVE_POLY5);
+#if POLY_CLOCKED == POLY_CLOCKED_TABLE
+		poly_data[wavetype] = static_cast<unsigned int const *>(MapWaveCache(poly4poly5_cache, "poly4poly5", sizeof(poly4poly5), InitPoly4Poly5, poly4poly5));
+#endif
+		break;
+	case WAVE_POLY17_POLY5:
+		InitPoly(WAVE_POLY17);
+		InitPoly(WAVE_POLY5);
+#if POLY_CLOCKED == POLY_CLOCKED_TABLE
+		poly_data[wavetype] = static_cast<unsigned int const *>(MapWaveCache(poly17poly5_cache, "poly17poly5", sizeof(poly17poly5), InitPoly17Poly5, poly17poly5));
+#endif
+		break;
+	default:
+		break;
+	}
+}
+
+// steps of the sequence for a poly wave type
+// (count steps from 1 to 32 starting at step i, with step i in the low bit;
+// steps past count are unspecified)
+static __forceinline unsigned int GetPolyWindow(Wave const wavetype, int const i, int const count)
+{
+#if POLY_CLOCKED == POLY_CLOCKED_COMPUTED
+	if (wavetype == WAVE_POLY4_POLY5)
+		return GetClockedPolyWindow(poly4, POLY4_LENGTH, POLY4_POLY5_LENGTH, i, count);
+	if (wavetype == WAVE_POLY17_POLY5)
+		return GetClockedPolyWindow(poly17, POLY17_LENGTH, POLY17_POLY5_LENGTH, i, count);
+#else
+	(void)count;	// the tables hold every step of the sequence
+#endif
+	return GetPolyWindow(poly_data[wavetype], i);
+}
+
+// shared poly oscillator
+template<bool ANTIALIASED, bool SYNC> static __forceinline float EvaluatePoly(OscillatorConfig const &config, OscillatorState &state, float step)
+{
+	// poly info for the wave type
+	int const cycle = wave_loop_cycle[config.wavetype];
+	if (step > 0.5f * cycle)
+		return 0;
+
+	// current wavetable value
+	float value = float(GetPolyWindow(config.wavetype, state.index, 1) & 1);
+
+#if ANTIALIAS == ANTIALIAS_POLYBLEP
+	if (ANTIALIASED)
+	{
+		float w = Min(step * POLYBLEP_WIDTH, 8.0f);
+
+		int const back = FloorInt(state.phase - w);
+		int const ahead = FloorInt(state.phase + w);
+		int const count = ahead - back;
+		if (count > 0)
+		{
+			int i = state.index + back + cycle;
+			if (i >= cycle)
+				i -= cycle;
+
+			// steps from back to ahead, and the edges between them
+			// (edge c is between steps c and c + 1)
+			unsigned int const window = GetPolyWindow(config.wavetype, i, count + 1);
+			unsigned int edges = (window ^ (window >> 1)) & ((1U << count) - 1);
+			float const t = state.phase - back;
+			while (edges)
+			{
+				int const c = LowestBit(edges);
+				edges &= edges - 1;
+				value += PolyBLEP(t - float(c + 1), w, (window >> (c + 1)) & 1 ? 1.0f : -1.0f);
+			}
+		}
+	}
+#endif
+
+	return value + value - 1.0f;
+}
+
+// shared poly oscillator
+// (flags tested at run time; see poly_render for block rendering)
+float OscillatorPoly(OscillatorConfig const &config, OscillatorState &state, float step)
+{
+	if (use_antialias)
+		return EvaluatePoly<true, false>(config, state, step);
+	return EvaluatePoly<false, false>(config, state, step);
+}
+
+// shared poly oscillator kernels
+WaveRender const poly_render[2][2][2] = OSCILLATOR_KERNELS(EvaluatePoly);
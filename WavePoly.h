@@ -1,28 +1,59 @@
-#pragma once
-/*
-MINI VIRTUAL ANALOG SYNTHESIZER
-Copyright 2014 Kenneth D. Miller III
-
-Poly-Noise Wave
-*/
-
-class OscillatorConfig;
-class OscillatorState;
-
-// precomputed linear feedback shift register output
-extern char poly4[(1 << 4) - 1];
-extern char poly5[(1 << 5) - 1];
-extern char period93[93];
-extern char poly9[(1 << 9) - 1];
-extern char poly17[(1 << 17) - 1];
-
-// precomputed wave tables for poly5-clocked waveforms
-extern char pulsepoly5[ARRAY_SIZE(poly5) * 2];
-extern char poly4poly5[ARRAY_SIZE(poly5) * ARRAY_SIZE(poly4)];
-extern char poly17poly5[ARRAY_SIZE(poly5) * ARRAY_SIZE(poly17)];
-
-// initialize polynomial noise tables
-extern void InitPoly();
-
-// poly waveform
-extern float OscillatorPoly(OscillatorConfig const &config, OscillatorState &state, float step);
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Poly-Noise Wave
+*/
+
+class OscillatorConfig;
+class OscillatorState;
+
+// poly5-clocked wave storage
+// - table: bit-packed tables of the combined sequences (about 500 KB)
+// - computed: combine the poly4 or poly17 output with the poly5 clock
+//   at each step (no table; a few more operations per step)
+// (pulse/poly5 is always a table; it is only 62 steps long)
+#define POLY_CLOCKED_TABLE 0
+#define POLY_CLOCKED_COMPUTED 1
+#define POLY_CLOCKED POLY_CLOCKED_TABLE
+
+// linear feedback shift register sequence lengths
+#define POLY4_LENGTH ((1 << 4) - 1)
+#define POLY5_LENGTH ((1 << 5) - 1)
+#define PERIOD93_LENGTH 93
+#define POLY9_LENGTH ((1 << 9) - 1)
+#define POLY17_LENGTH ((1 << 17) - 1)
+
+// poly5-clocked sequence lengths
+#define PULSE_POLY5_LENGTH (POLY5_LENGTH * 2)
+#define POLY4_POLY5_LENGTH (POLY5_LENGTH * POLY4_LENGTH)
+#define POLY17_POLY5_LENGTH (POLY5_LENGTH * POLY17_LENGTH)
+
+// words in a bit-packed sequence
+// (32 steps per word, with room to repeat the start of the sequence
+// for a 32-step window past the end)
+#define POLY_WORDS(length) (((length) + 63) / 32 + 1)
+
+// precomputed linear feedback shift register output
+// (step i is bit i % 32 of word i / 32)
+extern unsigned int poly4[POLY_WORDS(POLY4_LENGTH)];
+extern unsigned int poly5[POLY_WORDS(POLY5_LENGTH)];
+extern unsigned int period93[POLY_WORDS(PERIOD93_LENGTH)];
+extern unsigned int poly9[POLY_WORDS(POLY9_LENGTH)];
+extern unsigned int poly17[POLY_WORDS(POLY17_LENGTH)];
+
+// precomputed wave table for the pulse/poly5 waveform
+// (the other poly5-clocked tables may be mapped from the wave cache)
+extern unsigned int pulsepoly5[POLY_WORDS(PULSE_POLY5_LENGTH)];
+
+// build the tables a poly wave type uses
+// (the first time for each table)
+extern void InitPoly(Wave const wavetype);
+
+// poly waveform
+extern float OscillatorPoly(OscillatorConfig const &config, OscillatorState &state, float step);
+
+// shared poly oscillator kernels
+// (indexed by antialiasing, hard sync, and sub-oscillator)
+extern WaveRender const poly_render[2][2][2];
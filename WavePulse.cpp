@@ -1,98 +1,223 @@
-/*
-MINI VIRTUAL ANALOG SYNTHESIZER
-Copyright 2014 Kenneth D. Miller III
-
-Pulse Wave
-*/
-#include "StdAfx.h"
-
-#include "Wave.h"
-#include "WavePulse.h"
-#include "Oscillator.h"
-#include "PolyBLEP.h"
-#include "Math.h"
-
-// pulse waveform
-// - param controls pulse width
-// - pulse width 0.5 is square wave
-// - 4/pi sum k=0..infinity sin((2*k+1)*2*pi*phase)/(2*k+1)
-// - smoothed transition to reduce aliasing
-static __forceinline float GetPulseValue(float const phase, float const width)
-{
-	return phase < width ? 1.0f : -1.0f;
-}
-float OscillatorPulse(OscillatorConfig const &config, OscillatorState &state, float step)
-{
-	if (step > 0.5f)
-		return 0.0f;
-	if (config.waveparam <= 0.0f)
-		return -1.0f;
-	if (config.waveparam >= 1.0f)
-		return 1.0f;
-	float const phase = state.phase;
-	float value = GetPulseValue(phase, config.waveparam);
-#if ANTIALIAS == ANTIALIAS_POLYBLEP
-	if (use_antialias)
-	{
-		float const w = Min(step * POLYBLEP_WIDTH, 0.5f);
-
-		// nearest up edge
-		float const up_nearest = float(phase - 0.5f >= 0);
-
-		// nearest down edge
-		float const down_nearest = float(phase - 0.5f >= config.waveparam) - float(phase + 0.5f < config.waveparam) + config.waveparam;
-
-		if (config.sync_enable)
-		{
-			// short-circuit case
-			if (config.sync_phase < config.waveparam)
-				return 1.0f;
-
-			// shift sync phase into range
-			int const index = state.index;
-			float sync_phase = config.sync_phase - index;
-
-			// last up transition before sync
-			float const up_before_sync = float(CeilingInt(sync_phase) - 1);
-
-			if (index == 0)
-			{
-				// handle discontinuity at zero phase
-				if (sync_phase > up_before_sync + config.waveparam)
-				{
-					// down edge before sync wrapped before zero
-					value -= PolyBLEP(phase - (up_before_sync + config.waveparam - sync_phase), w);
-					// up edge at 0
-					value += PolyBLEP(phase, w);
-				}
-				else
-				{
-					// up edge before sync wrapped before zero
-					value += PolyBLEP(phase - (up_before_sync - sync_phase), w);
-				}
-			}
-
-			// handle nearest up transition if it's in range
-			if (up_nearest > -index && up_nearest <= up_before_sync)
-				value += PolyBLEP(phase - up_nearest, w);
-
-			// handle nearest down transition if it's in range
-			if (down_nearest > -index && down_nearest < sync_phase)
-				value -= PolyBLEP(phase - down_nearest, w);
-
-			// handle discontinuity at sync phase
-			if (sync_phase > up_before_sync + config.waveparam)
-			{
-				// up edge at config.sync_phase
-				value += PolyBLEP(phase - sync_phase, w);
-			}
-		}
-		else
-		{
-			value += PolyBLEP(phase - up_nearest, w);
-			value -= PolyBLEP(phase - down_nearest, w);
-		}
-	}
-#endif
-	return value;
-}
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Pulse Wave
+*/
+#include "Platform.h"
+
+#include "Wave.h"
+#include "WavePulse.h"
+#include "Oscillator.h"
+#include "OscillatorKernel.h"
+#include "PolyBLEP.h"
+#include "Wavetable.h"
+#include "Math.h"
+
+// pulse waveform
+// - param controls pulse width
+// - pulse width 0.5 is square wave
+// - 4/pi sum k=0..infinity sin((2*k+1)*2*pi*phase)/(2*k+1)
+// - smoothed transition to reduce aliasing
+static __forceinline float GetPulseValue(float const phase, float const width)
+{
+	return phase < width ? 1.0f : -1.0f;
+}
+static __forceinline SIMDFloat GetPulseValue(SIMDFloat const phase, SIMDFloat const width)
+{
+	return Select(phase < width, SIMDFloat(1.0f), SIMDFloat(-1.0f));
+}
+template<bool ANTIALIASED, bool SYNC> static __forceinline float EvaluatePulse(OscillatorConfig const &config, OscillatorState &state, float step)
+{
+	if (step > 0.5f)
+		return 0.0f;
+	if (config.waveparam <= 0.0f)
+		return -1.0f;
+	if (config.waveparam >= 1.0f)
+		return 1.0f;
+	float const phase = state.phase;
+	float value = GetPulseValue(phase, config.waveparam);
+#if ANTIALIAS == ANTIALIAS_POLYBLEP
+	if (ANTIALIASED)
+	{
+		float const w = Min(step * POLYBLEP_WIDTH, 0.5f);
+
+		// nearest up edge
+		float const up_nearest = float(phase - 0.5f >= 0);
+
+		// nearest down edge
+		float const down_nearest = float(phase - 0.5f >= config.waveparam) - float(phase + 0.5f < config.waveparam) + config.waveparam;
+
+		if (SYNC)
+		{
+			// short-circuit case
+			if (config.sync_phase < config.waveparam)
+				return 1.0f;
+
+			// shift sync phase into range
+			int const index = state.index;
+			float sync_phase = config.sync_phase - index;
+
+			// last up transition before sync
+			float const up_before_sync = float(CeilingInt(sync_phase) - 1);
+
+			if (index == 0)
+			{
+				// handle discontinuity at zero phase
+				if (sync_phase > up_before_sync + config.waveparam)
+				{
+					// down edge before sync wrapped before zero
+					value -= PolyBLEP(phase - (up_before_sync + config.waveparam - sync_phase), w);
+					// up edge at 0
+					value += PolyBLEP(phase, w);
+				}
+				else
+				{
+					// up edge before sync wrapped before zero
+					value += PolyBLEP(phase - (up_before_sync - sync_phase), w);
+				}
+			}
+
+			// handle nearest up transition if it's in range
+			if (up_nearest > -index && up_nearest <= up_before_sync)
+				value += PolyBLEP(phase - up_nearest, w);
+
+			// handle nearest down transition if it's in range
+			if (down_nearest > -index && down_nearest < sync_phase)
+				value -= PolyBLEP(phase - down_nearest, w);
+
+			// handle discontinuity at sync phase
+			if (sync_phase > up_before_sync + config.waveparam)
+			{
+				// up edge at config.sync_phase
+				value += PolyBLEP(phase - sync_phase, w);
+			}
+		}
+		else
+		{
+			value += PolyBLEP(phase - up_nearest, w);
+			value -= PolyBLEP(phase - down_nearest, w);
+		}
+	}
+#endif
+	return value;
+}
+
+// pulse wave
+// (flags tested at run time; see pulse_render for block rendering)
+float OscillatorPulse(OscillatorConfig const &config, OscillatorState &state, float step)
+{
+	if (!use_antialias)
+		return EvaluatePulse<false, false>(config, state, step);
+	if (config.sync_enable)
+		return EvaluatePulse<true, true>(config, state, step);
+	return EvaluatePulse<true, false>(config, state, step);
+}
+
+// pulse wave for a group of oscillators
+// (same as OscillatorPulse without hard sync)
+template<bool ANTIALIASED> static void OscillatorPulseGroup(OscillatorConfig const &config, OscillatorGroup &group, size_t count)
+{
+	SIMDFloat amplitude(config.amplitude);
+	SIMDFloat const amplitude_step(config.amplitude_step);
+	float waveparam = config.waveparam;
+	for (size_t i = 0; i < count; ++i)
+	{
+		SIMDFloat const silent = group.delta > SIMDFloat(0.5f);
+		SIMDFloat const w = Min(group.delta * SIMDFloat(POLYBLEP_WIDTH), SIMDFloat(0.5f));
+		SIMDFloat const width(waveparam);
+		SIMDFloat const phase = group.phase;
+		SIMDFloat value = GetPulseValue(phase, width);
+#if ANTIALIAS == ANTIALIAS_POLYBLEP
+		if (ANTIALIASED && waveparam > 0.0f && waveparam < 1.0f)
+		{
+			// nearest up edge
+			SIMDFloat const up_nearest = Select(phase - SIMDFloat(0.5f) >= SIMDFloat(0.0f), SIMDFloat(1.0f), SIMDFloat(0.0f));
+
+			// nearest down edge
+			SIMDFloat const down_nearest =
+				Select(phase - SIMDFloat(0.5f) >= width, SIMDFloat(1.0f), SIMDFloat(0.0f)) -
+				Select(phase + SIMDFloat(0.5f) < width, SIMDFloat(1.0f), SIMDFloat(0.0f)) + width;
+
+			value = value + PolyBLEP(phase - up_nearest, w);
+			value = value - PolyBLEP(phase - down_nearest, w);
+		}
+#endif
+
+		// constant output for pulse width outside (0, 1)
+		if (waveparam <= 0.0f || waveparam >= 1.0f)
+			value = SIMDFloat(waveparam <= 0.0f ? -1.0f : 1.0f);
+
+		group.Accumulate(i, amplitude * Select(silent, SIMDFloat(0.0f), value));
+		amplitude = amplitude + amplitude_step;
+		waveparam += config.waveparam_step;
+		group.Advance();
+	}
+}
+
+// pulse wave kernels
+WaveRender const pulse_render[2][2][2] = OSCILLATOR_KERNELS(EvaluatePulse);
+
+// pulse wave group functions
+WaveRenderGroup const pulse_render_group[2] = { OscillatorPulseGroup<false>, OscillatorPulseGroup<true> };
+
+// band-limited pulse wave
+// (the difference of two sawtooth waves offset by the pulse width)
+class PulseTableReader
+{
+public:
+	WavetableMip mip;
+	float width;
+
+	PulseTableReader(OscillatorConfig const &config, float const delta)
+		: mip(delta)
+		, width(Clamp(config.waveparam, 0.0f, 1.0f))
+	{
+	}
+
+	float Read(float const phase) const
+	{
+		return mip.Read(sawtooth_wavetable, phase) - mip.Read(sawtooth_wavetable, phase - width + 1.0f) + width + width - 1.0f;
+	}
+};
+
+// pulse wavetable kernels
+WaveRender const pulse_table_render[2] = WAVETABLE_KERNELS(PulseTableReader);
+
+// pulse wave discontinuities
+// (a step up at each whole phase and a step down at the pulse width;
+// none for pulse widths outside (0, 1), which are constant)
+class PulseEdges
+{
+public:
+	float width;
+	float height;
+
+	explicit PulseEdges(OscillatorConfig const &config)
+		: width(Clamp(config.waveparam, 0.0f, 1.0f))
+		, height(config.waveparam > 0.0f && config.waveparam < 1.0f ? 2.0f : 0.0f)
+	{
+	}
+
+	float Value(float const phase) const
+	{
+		return GetPulseValue(phase, width);
+	}
+
+	void Add(MinBLEPBuffer &blep, float const from, float const to, float const end, float const scale) const
+	{
+		if (height == 0.0f)
+			return;
+		for (int k = FloorInt(from); k <= to; ++k)
+		{
+			if (k > from)
+				blep.Add((end - k) * scale, height);
+			float const down = k + width;
+			if (down > from && down <= to)
+				blep.Add((end - down) * scale, -height);
+		}
+	}
+};
+
+// pulse MinBLEP kernels
+WaveRender const pulse_minblep_render[2][2] = MINBLEP_KERNELS(PulseEdges);
@@ -1,12 +1,29 @@
-#pragma once
-/*
-MINI VIRTUAL ANALOG SYNTHESIZER
-Copyright 2014 Kenneth D. Miller III
-
-Pulse Wave
-*/
-
-class OscillatorConfig;
-class OscillatorState;
-
-extern float OscillatorPulse(OscillatorConfig const &config, OscillatorState &state, float step);
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Pulse Wave
+*/
+
+class OscillatorConfig;
+class OscillatorState;
+class OscillatorGroup;
+
+extern float OscillatorPulse(OscillatorConfig const &config, OscillatorState &state, float step);
+
+// pulse wave kernels
+// (indexed by antialiasing, hard sync, and sub-oscillator)
+extern WaveRender const pulse_render[2][2][2];
+
+// pulse wave group functions
+// (indexed by antialiasing)
+extern WaveRenderGroup const pulse_render_group[2];
+
+// pulse wavetable kernels
+// (indexed by sub-oscillator)
+extern WaveRender const pulse_table_render[2];
+
+// pulse MinBLEP kernels
+// (indexed by hard sync and sub-oscillator)
+extern WaveRender const pulse_minblep_render[2][2];
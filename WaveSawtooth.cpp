@@ -1,66 +1,160 @@
-/*
-MINI VIRTUAL ANALOG SYNTHESIZER
-Copyright 2014 Kenneth D. Miller III
-
-Sawtooth Wave
-*/
-#include "StdAfx.h"
-
-#include "Wave.h"
-#include "Oscillator.h"
-#include "PolyBLEP.h"
-#include "Math.h"
-
-// sawtooth wave
-// - 2/pi sum k=1..infinity sin(k*2*pi*phase)/n
-// - smoothed transition to reduce aliasing
-static __forceinline float GetSawtoothValue(float const phase)
-{
-	return 1 - phase - phase;
-}
-float OscillatorSawtooth(OscillatorConfig const &config, OscillatorState &state, float step)
-{
-	if (step > 0.5f)
-		return 0.0f;
-	float phase = state.phase;
-	float value = GetSawtoothValue(phase);
-
-#if ANTIALIAS == ANTIALIAS_POLYBLEP
-	if (use_antialias)
-	{
-		float const w = Min(step * POLYBLEP_WIDTH, 0.5f);
-
-		// up edge nearest the current phase
-		float up_nearest = float(phase >= 0.5f);
-
-		if (config.sync_enable)
-		{
-			int const index = state.index;
-			phase += index;
-			up_nearest += index;
-			float const sync_fraction = config.sync_phase - float(FloorInt(config.sync_phase));
-
-			// handle last integer phase before sync from the previous wave cycle
-			float const up_before_zero = -sync_fraction;
-			value += PolyBLEP(phase - up_before_zero, w);
-
-			// handle discontinuity at integer phases
-			if (up_nearest > 0 && up_nearest <= config.sync_phase)
-				value += PolyBLEP(phase - up_nearest, w);
-
-			// handle discontituity at sync phase
-			float const sync_value = GetSawtoothValue(sync_fraction);
-			if (sync_value < 0.999969482421875f)
-			{
-				value += PolyBLEP(phase, w, 1 - sync_value);
-				value += PolyBLEP(phase - config.sync_phase, w, 1 - sync_value);
-			}
-		}
-		else
-		{
-			value += PolyBLEP(phase - up_nearest, w);
-		}
-	}
-#endif
-	return value;
-}
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Sawtooth Wave
+*/
+#include "Platform.h"
+
+#include "Wave.h"
+#include "WaveSawtooth.h"
+#include "Oscillator.h"
+#include "OscillatorKernel.h"
+#include "PolyBLEP.h"
+#include "Wavetable.h"
+#include "Math.h"
+
+// sawtooth wave
+// - 2/pi sum k=1..infinity sin(k*2*pi*phase)/n
+// - smoothed transition to reduce aliasing
+static __forceinline float GetSawtoothValue(float const phase)
+{
+	return 1 - phase - phase;
+}
+static __forceinline SIMDFloat GetSawtoothValue(SIMDFloat const phase)
+{
+	return SIMDFloat(1.0f) - phase - phase;
+}
+template<bool ANTIALIASED, bool SYNC> static __forceinline float EvaluateSawtooth(OscillatorConfig const &config, OscillatorState &state, float step)
+{
+	if (step > 0.5f)
+		return 0.0f;
+	float phase = state.phase;
+	float value = GetSawtoothValue(phase);
+
+#if ANTIALIAS == ANTIALIAS_POLYBLEP
+	if (ANTIALIASED)
+	{
+		float const w = Min(step * POLYBLEP_WIDTH, 0.5f);
+
+		// up edge nearest the current phase
+		float up_nearest = float(phase >= 0.5f);
+
+		if (SYNC)
+		{
+			int const index = state.index;
+			phase += index;
+			up_nearest += index;
+			float const sync_fraction = config.sync_phase - float(FloorInt(config.sync_phase));
+
+			// handle last integer phase before sync from the previous wave cycle
+			float const up_before_zero = -sync_fraction;
+			value += PolyBLEP(phase - up_before_zero, w);
+
+			// handle discontinuity at integer phases
+			if (up_nearest > 0 && up_nearest <= config.sync_phase)
+				value += PolyBLEP(phase - up_nearest, w);
+
+			// handle discontituity at sync phase
+			float const sync_value = GetSawtoothValue(sync_fraction);
+			if (sync_value < 0.999969482421875f)
+			{
+				value += PolyBLEP(phase, w, 1 - sync_value);
+				value += PolyBLEP(phase - config.sync_phase, w, 1 - sync_value);
+			}
+		}
+		else
+		{
+			value += PolyBLEP(phase - up_nearest, w);
+		}
+	}
+#endif
+	return value;
+}
+
+// sawtooth wave
+// (flags tested at run time; see sawtooth_render for block rendering)
+float OscillatorSawtooth(OscillatorConfig const &config, OscillatorState &state, float step)
+{
+	if (!use_antialias)
+		return EvaluateSawtooth<false, false>(config, state, step);
+	if (config.sync_enable)
+		return EvaluateSawtooth<true, true>(config, state, step);
+	return EvaluateSawtooth<true, false>(config, state, step);
+}
+
+// sawtooth wave for a group of oscillators
+// (same as OscillatorSawtooth without hard sync)
+template<bool ANTIALIASED> static void OscillatorSawtoothGroup(OscillatorConfig const &config, OscillatorGroup &group, size_t count)
+{
+	SIMDFloat amplitude(config.amplitude);
+	SIMDFloat const amplitude_step(config.amplitude_step);
+	for (size_t i = 0; i < count; ++i)
+	{
+		SIMDFloat const silent = group.delta > SIMDFloat(0.5f);
+		SIMDFloat const w = Min(group.delta * SIMDFloat(POLYBLEP_WIDTH), SIMDFloat(0.5f));
+		SIMDFloat const phase = group.phase;
+		SIMDFloat value = GetSawtoothValue(phase);
+#if ANTIALIAS == ANTIALIAS_POLYBLEP
+		if (ANTIALIASED)
+		{
+			// up edge nearest the current phase
+			SIMDFloat const up_nearest = Select(phase >= SIMDFloat(0.5f), SIMDFloat(1.0f), SIMDFloat(0.0f));
+			value = value + PolyBLEP(phase - up_nearest, w);
+		}
+#endif
+		group.Accumulate(i, amplitude * Select(silent, SIMDFloat(0.0f), value));
+		amplitude = amplitude + amplitude_step;
+		group.Advance();
+	}
+}
+
+// sawtooth wave kernels
+WaveRender const sawtooth_render[2][2][2] = OSCILLATOR_KERNELS(EvaluateSawtooth);
+
+// sawtooth wave group functions
+WaveRenderGroup const sawtooth_render_group[2] = { OscillatorSawtoothGroup<false>, OscillatorSawtoothGroup<true> };
+
+// band-limited sawtooth wave
+class SawtoothTableReader
+{
+public:
+	WavetableMip mip;
+
+	SawtoothTableReader(OscillatorConfig const &, float const delta)
+		: mip(delta)
+	{
+	}
+
+	float Read(float const phase) const
+	{
+		return mip.Read(sawtooth_wavetable, phase);
+	}
+};
+
+// sawtooth wavetable kernels
+WaveRender const sawtooth_table_render[2] = WAVETABLE_KERNELS(SawtoothTableReader);
+
+// sawtooth wave discontinuities
+// (a step up at each whole phase)
+class SawtoothEdges
+{
+public:
+	explicit SawtoothEdges(OscillatorConfig const &)
+	{
+	}
+
+	float Value(float const phase) const
+	{
+		return GetSawtoothValue(phase);
+	}
+
+	void Add(MinBLEPBuffer &blep, float const from, float const to, float const end, float const scale) const
+	{
+		for (int k = FloorInt(from) + 1; k <= to; ++k)
+			blep.Add((end - k) * scale, 2.0f);
+	}
+};
+
+// sawtooth MinBLEP kernels
+WaveRender const sawtooth_minblep_render[2][2] = MINBLEP_KERNELS(SawtoothEdges);
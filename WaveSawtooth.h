@@ -1,12 +1,29 @@
-#pragma once
-/*
-MINI VIRTUAL ANALOG SYNTHESIZER
-Copyright 2014 Kenneth D. Miller III
-
-Sawtooth Wave
-*/
-
-class OscillatorConfig;
-class OscillatorState;
-
-extern float OscillatorSawtooth(OscillatorConfig const &config, OscillatorState &state, float step);
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Sawtooth Wave
+*/
+
+class OscillatorConfig;
+class OscillatorState;
+class OscillatorGroup;
+
+extern float OscillatorSawtooth(OscillatorConfig const &config, OscillatorState &state, float step);
+
+// sawtooth wave kernels
+// (indexed by antialiasing, hard sync, and sub-oscillator)
+extern WaveRender const sawtooth_render[2][2][2];
+
+// sawtooth wave group functions
+// (indexed by antialiasing)
+extern WaveRenderGroup const sawtooth_render_group[2];
+
+// sawtooth wavetable kernels
+// (indexed by sub-oscillator)
+extern WaveRender const sawtooth_table_render[2];
+
+// sawtooth MinBLEP kernels
+// (indexed by hard sync and sub-oscillator)
+extern WaveRender const sawtooth_minblep_render[2][2];
@@ -1,57 +1,231 @@
-/*
-MINI VIRTUAL ANALOG SYNTHESIZER
-Copyright 2014 Kenneth D. Miller III
-
-Sine Wave
-*/
-#include "StdAfx.h"
-
-#include "Wave.h"
-#include "Oscillator.h"
-#include "PolyBLEP.h"
-#include "Math.h"
-
-static float const SINE_VALUE_AT_0 = 0.0f;
-static float const SINE_SLOPE_AT_0 = M_PI * 2;
-
-// sine wave
-static __forceinline float GetSineValue(float const phase)
-{
-	return sinf(M_PI * 2 * phase);
-}
-static __forceinline float GetSineSlope(float const phase)
-{
-	return 2 * M_PI * cosf(M_PI * 2 * phase);
-}
-float OscillatorSine(OscillatorConfig const &config, OscillatorState &state, float step)
-{
-	if (step > 0.5f)
-		return 0.0f;
-	float phase = state.phase;
-	float value = GetSineValue(phase);
-#if ANTIALIAS == ANTIALIAS_POLYBLEP
-	if (use_antialias && config.sync_enable)
-	{
-		int const index = state.index;
-		phase += index;
-
-		float const w = Min(step * POLYBLEP_WIDTH, 1.0f);
-
-		// handle discontinuity at zero phase
-		if (phase < w)
-		{
-			value -= PolyBLEP(phase, w, GetSineValue(config.sync_phase) - SINE_VALUE_AT_0);
-			value -= IntegratedPolyBLEP(phase, w, GetSineSlope(config.sync_phase) - SINE_SLOPE_AT_0);
-		}
-
-		// handle discontinuity at sync phase
-		if (phase - config.sync_phase > -w)
-		{
-			value -= PolyBLEP(phase - config.sync_phase, w, GetSineValue(config.sync_phase) - SINE_VALUE_AT_0);
-			value -= IntegratedPolyBLEP(phase - config.sync_phase, w, GetSineSlope(config.sync_phase) - SINE_SLOPE_AT_0);
-		}
-	}
-#endif
-	return value;
-}
-
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Sine Wave
+*/
+#include "Platform.h"
+
+#include "Wave.h"
+#include "WaveSine.h"
+#include "Oscillator.h"
+#include "OscillatorKernel.h"
+#include "PolyBLEP.h"
+#include "Math.h"
+
+static float const SINE_VALUE_AT_0 = 0.0f;
+static float const SINE_SLOPE_AT_0 = M_PI * 2;
+
+// sine wave
+// (polynomial approximation; see FastSine)
+static __forceinline float GetSineValue(float const phase)
+{
+	return FastSine(phase);
+}
+static __forceinline float GetSineSlope(float const phase)
+{
+	return 2 * M_PI * FastSine(phase + 0.25f);
+}
+template<bool ANTIALIASED, bool SYNC> static __forceinline float EvaluateSine(OscillatorConfig const &config, OscillatorState &state, float step)
+{
+	if (step > 0.5f)
+		return 0.0f;
+	float phase = state.phase;
+	float value = GetSineValue(phase);
+#if ANTIALIAS == ANTIALIAS_POLYBLEP
+	if (ANTIALIASED && SYNC)
+	{
+		int const index = state.index;
+		phase += index;
+
+		float const w = Min(step * POLYBLEP_WIDTH, 1.0f);
+
+		// handle discontinuity at zero phase
+		if (phase < w)
+		{
+			value -= PolyBLEP(phase, w, GetSineValue(config.sync_phase) - SINE_VALUE_AT_0);
+			value -= IntegratedPolyBLEP(phase, w, GetSineSlope(config.sync_phase) - SINE_SLOPE_AT_0);
+		}
+
+		// handle discontinuity at sync phase
+		if (phase - config.sync_phase > -w)
+		{
+			value -= PolyBLEP(phase - config.sync_phase, w, GetSineValue(config.sync_phase) - SINE_VALUE_AT_0);
+			value -= IntegratedPolyBLEP(phase - config.sync_phase, w, GetSineSlope(config.sync_phase) - SINE_SLOPE_AT_0);
+		}
+	}
+#endif
+	return value;
+}
+
+// sine wave
+// (flags tested at run time; see sine_render for block rendering)
+float OscillatorSine(OscillatorConfig const &config, OscillatorState &state, float step)
+{
+	if (!use_antialias)
+		return EvaluateSine<false, false>(config, state, step);
+	if (config.sync_enable)
+		return EvaluateSine<true, true>(config, state, step);
+	return EvaluateSine<true, false>(config, state, step);
+}
+
+// quadrature oscillator steps between amplitude corrections
+// (a power of two; correcting every step costs more than the rotation)
+static size_t const SINE_RENORMALIZE = 16;
+
+// rotation by one phase step for a quadrature oscillator
+// (computed in double precision once per block so the rotation
+// neither grows nor shrinks the amplitude by more than rounding)
+static __forceinline void GetSineRotation(float const delta, float &rotate_cos, float &rotate_sin)
+{
+	rotate_cos = float(cos(M_PI * 2 * double(delta)));
+	rotate_sin = float(sin(M_PI * 2 * double(delta)));
+}
+
+// sine wave kernel without hard sync
+// (a quadrature oscillator rotates the sine and cosine by the phase step
+// each sample instead of evaluating the sine; a first-order correction
+// keeps the amplitude near 1, and it starts over from the oscillator phase
+// every block, so rounding error only accumulates for one control update;
+// a ramping phase step turns the rotation itself by the step change)
+template<bool SUB> static void OscillatorSineKernel(NoteOscillatorConfig const &config, OscillatorState &state, float step, float buffer[], size_t count)
+{
+	float delta = config.frequency * config.adjust * step;
+	float const delta_step = config.frequency_step * config.adjust * step;
+	if (Max(delta, delta + delta_step * float(count)) > 0.5f)
+	{
+		OscillatorKernel<EvaluateSine<false, false>, false, SUB>(config, state, step, buffer, count);
+		return;
+	}
+
+	float rotate_cos, rotate_sin;
+	GetSineRotation(delta, rotate_cos, rotate_sin);
+	float ramp_cos = 1.0f, ramp_sin = 0.0f;
+	bool const ramp = delta_step != 0.0f;
+	if (ramp)
+		GetSineRotation(delta_step, ramp_cos, ramp_sin);
+	float value_sin = GetSineValue(state.phase);
+	float value_cos = GetSineValue(state.phase + 0.25f);
+	float amplitude = config.amplitude;
+#if OSCILLATOR_PHASE != OSCILLATOR_PHASE_FLOAT
+	unsigned long long delta_fixed = PhaseToFixed(delta);
+#endif
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		// accumulate sub-oscillator value
+		if (SUB)
+			buffer[i] += config.sub_osc_amplitude * SubOscillator(config, state, step);
+
+		// accumulate oscillator value
+		buffer[i] += amplitude * value_sin;
+		amplitude += config.amplitude_step;
+
+		// rotate to the next phase
+		float const next_sin = value_sin * rotate_cos + value_cos * rotate_sin;
+		value_cos = value_cos * rotate_cos - value_sin * rotate_sin;
+		value_sin = next_sin;
+
+		// periodically pull the amplitude back toward 1
+		if ((i & (SINE_RENORMALIZE - 1)) == SINE_RENORMALIZE - 1)
+		{
+			float const gain = 1.5f - 0.5f * (value_sin * value_sin + value_cos * value_cos);
+			value_sin *= gain;
+			value_cos *= gain;
+		}
+
+		// advance oscillator phase
+#if OSCILLATOR_PHASE == OSCILLATOR_PHASE_FLOAT
+		state.Advance<false>(config, delta);
+#else
+		state.AdvanceFixed<false>(config, delta_fixed, 0);
+#endif
+
+		// ramp phase step and rotation
+		if (ramp)
+		{
+			float const next_rotate_sin = rotate_sin * ramp_cos + rotate_cos * ramp_sin;
+			rotate_cos = rotate_cos * ramp_cos - rotate_sin * ramp_sin;
+			rotate_sin = next_rotate_sin;
+			delta += delta_step;
+#if OSCILLATOR_PHASE != OSCILLATOR_PHASE_FLOAT
+			delta_fixed = PhaseToFixed(delta);
+#endif
+		}
+	}
+}
+
+// sine wave for a group of oscillators
+// (same as OscillatorSineKernel: a quadrature oscillator per lane)
+static void OscillatorSineGroup(OscillatorConfig const &config, OscillatorGroup &group, size_t count)
+{
+	// rotation and rotation change for each lane
+	SIMD_ALIGN float d[SIMD_WIDTH], c[SIMD_WIDTH], s[SIMD_WIDTH];
+	group.delta.Store(d);
+	for (int lane = 0; lane < SIMD_WIDTH; ++lane)
+		GetSineRotation(d[lane], c[lane], s[lane]);
+	SIMDFloat rotate_cos = SIMDFloat::Load(c);
+	SIMDFloat rotate_sin = SIMDFloat::Load(s);
+	bool const ramp = config.frequency_step != 0.0f;
+	group.delta_step.Store(d);
+	for (int lane = 0; lane < SIMD_WIDTH; ++lane)
+	{
+		c[lane] = 1.0f, s[lane] = 0.0f;
+		if (d[lane] != 0.0f)
+			GetSineRotation(d[lane], c[lane], s[lane]);
+	}
+	SIMDFloat const ramp_cos = SIMDFloat::Load(c);
+	SIMDFloat const ramp_sin = SIMDFloat::Load(s);
+
+	SIMDFloat amplitude(config.amplitude);
+	SIMDFloat const amplitude_step(config.amplitude_step);
+	SIMDFloat value_sin = FastSine(group.phase);
+	SIMDFloat value_cos = FastSine(group.phase + SIMDFloat(0.25f));
+	for (size_t i = 0; i < count; ++i)
+	{
+		SIMDFloat const silent = group.delta > SIMDFloat(0.5f);
+		group.Accumulate(i, amplitude * Select(silent, SIMDFloat(0.0f), value_sin));
+		amplitude = amplitude + amplitude_step;
+
+		// rotate to the next phase
+		SIMDFloat const next_sin = value_sin * rotate_cos + value_cos * rotate_sin;
+		value_cos = value_cos * rotate_cos - value_sin * rotate_sin;
+		value_sin = next_sin;
+
+		// periodically pull the amplitude back toward 1
+		if ((i & (SINE_RENORMALIZE - 1)) == SINE_RENORMALIZE - 1)
+		{
+			SIMDFloat const gain = SIMDFloat(1.5f) - SIMDFloat(0.5f) * (value_sin * value_sin + value_cos * value_cos);
+			value_sin = value_sin * gain;
+			value_cos = value_cos * gain;
+		}
+
+		group.Advance();
+
+		// ramp rotation
+		if (ramp)
+		{
+			SIMDFloat const next_rotate_sin = rotate_sin * ramp_cos + rotate_cos * ramp_sin;
+			rotate_cos = rotate_cos * ramp_cos - rotate_sin * ramp_sin;
+			rotate_sin = next_rotate_sin;
+		}
+	}
+}
+
+// sine wave kernels
+// (the quadrature kernel without hard sync, since an unsynced sine has
+// nothing to antialias; the polynomial evaluator with hard sync)
+WaveRender const sine_render[2][2][2] =
+{
+	{
+		{ OscillatorSineKernel<false>, OscillatorSineKernel<true> },
+		{ OscillatorKernel<EvaluateSine<false, true>, true, false>, OscillatorKernel<EvaluateSine<false, true>, true, true> },
+	},
+	{
+		{ OscillatorSineKernel<false>, OscillatorSineKernel<true> },
+		{ OscillatorKernel<EvaluateSine<true, true>, true, false>, OscillatorKernel<EvaluateSine<true, true>, true, true> },
+	},
+};
+
+// sine wave group functions
+WaveRenderGroup const sine_render_group[2] = { OscillatorSineGroup, OscillatorSineGroup };
@@ -1,13 +1,21 @@
-#pragma once
-/*
-MINI VIRTUAL ANALOG SYNTHESIZER
-Copyright 2014 Kenneth D. Miller III
-
-Sine Wave
-*/
-
-class OscillatorConfig;
-class OscillatorState;
-
-// sine wave
-float OscillatorSine(OscillatorConfig const &config, OscillatorState &state, float step);
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Sine Wave
+*/
+
+class OscillatorConfig;
+class OscillatorState;
+
+// sine wave
+float OscillatorSine(OscillatorConfig const &config, OscillatorState &state, float step);
+
+// sine wave kernels
+// (indexed by antialiasing, hard sync, and sub-oscillator)
+extern WaveRender const sine_render[2][2][2];
+
+// sine wave group functions
+// (indexed by antialiasing)
+extern WaveRenderGroup const sine_render_group[2];
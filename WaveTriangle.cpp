@@ -1,86 +1,162 @@
-/*
-MINI VIRTUAL ANALOG SYNTHESIZER
-Copyright 2014 Kenneth D. Miller III
-
-Triangle Wave
-*/
-#include "StdAfx.h"
-
-#include "Wave.h"
-#include "Oscillator.h"
-#include "PolyBLEP.h"
-#include "Math.h"
-
-// triangle oscillator
-// - 8/pi**2 sum k=0..infinity (-1)**k sin((2*k+1)*2*pi*phase)/(2*k+1)**2
-static __forceinline float GetTriangleValue(float const phase)
-{
-	return fabsf(4 * (phase - FloorInt(phase - 0.25f)) - 3) - 1;
-}
-float OscillatorTriangle(OscillatorConfig const &config, OscillatorState &state, float step)
-{
-	if (step > 0.5f)
-		return 0.0f;
-	float value = GetTriangleValue(state.phase);
-#if ANTIALIAS == ANTIALIAS_POLYBLEP
-	if (use_antialias)
-	{
-		float phase = state.phase;
-
-		float const w = Min(step * INTEGRATED_POLYBLEP_WIDTH, 0.5f);
-
-		// nearest /\ slope transtiion
-		float down_nearest = float(phase >= 0.75f) + 0.25f;
-
-		// nearest \/ slope transition
-		float up_nearest = float(phase >= 0.25f) - 0.25f;
-
-		if (config.sync_enable)
-		{
-			int const index = state.index;
-			phase += index;
-			down_nearest += index;
-			up_nearest += index;
-
-			// handle discontinuity at 0
-			if (phase < w)
-			{
-				// sync during downward slope creates a \/ transition
-				float const sync_fraction = config.sync_phase - float(FloorInt(config.sync_phase));
-				if (sync_fraction > 0.25f && sync_fraction < 0.75)
-					value += IntegratedPolyBLEP(phase, w);
-
-				// wave value discontinuity creates a | transition 
-				float const sync_value = GetTriangleValue(sync_fraction);
-				value -= PolyBLEP(phase, w, sync_value);
-			}
-
-			// handle /\ and \/ slope discontinuities
-			if (down_nearest > 0 && down_nearest < config.sync_phase)
-				value -= IntegratedPolyBLEP(phase - down_nearest, w);
-			if (up_nearest > 0 && up_nearest < config.sync_phase)
-				value += IntegratedPolyBLEP(phase - up_nearest, w);
-
-			// handle discontinuity at sync phase
-			if (phase - config.sync_phase > -w)
-			{
-				// sync during downward slope creates a \/ transition
-				float const sync_fraction = config.sync_phase - float(FloorInt(config.sync_phase));
-				if (sync_fraction > 0.25f && sync_fraction < 0.75)
-					value += IntegratedPolyBLEP(phase - config.sync_phase, w);
-
-				// wave value discontinuity creates a | transition 
-				float const sync_value = GetTriangleValue(sync_fraction);
-				value -= PolyBLEP(phase - config.sync_phase, w, sync_value);
-			}
-		}
-		else
-		{
-			// handle /\ and \/ slope discontinuities
-			value -= IntegratedPolyBLEP(phase - down_nearest, w);
-			value += IntegratedPolyBLEP(phase - up_nearest, w);
-		}
-	}
-#endif
-	return value;
-}
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Triangle Wave
+*/
+#include "Platform.h"
+
+#include "Wave.h"
+#include "WaveTriangle.h"
+#include "Oscillator.h"
+#include "OscillatorKernel.h"
+#include "PolyBLEP.h"
+#include "Wavetable.h"
+#include "Math.h"
+
+// triangle oscillator
+// - 8/pi**2 sum k=0..infinity (-1)**k sin((2*k+1)*2*pi*phase)/(2*k+1)**2
+static __forceinline float GetTriangleValue(float const phase)
+{
+	return fabsf(4 * (phase - FloorInt(phase - 0.25f)) - 3) - 1;
+}
+static __forceinline SIMDFloat GetTriangleValue(SIMDFloat const phase)
+{
+	return Abs(SIMDFloat(4.0f) * (phase - Floor(phase - SIMDFloat(0.25f))) - SIMDFloat(3.0f)) - SIMDFloat(1.0f);
+}
+template<bool ANTIALIASED, bool SYNC> static __forceinline float EvaluateTriangle(OscillatorConfig const &config, OscillatorState &state, float step)
+{
+	if (step > 0.5f)
+		return 0.0f;
+	float value = GetTriangleValue(state.phase);
+#if ANTIALIAS == ANTIALIAS_POLYBLEP
+	if (ANTIALIASED)
+	{
+		float phase = state.phase;
+
+		float const w = Min(step * INTEGRATED_POLYBLEP_WIDTH, 0.5f);
+
+		// nearest /\ slope transtiion
+		float down_nearest = float(phase >= 0.75f) + 0.25f;
+
+		// nearest \/ slope transition
+		float up_nearest = float(phase >= 0.25f) - 0.25f;
+
+		if (SYNC)
+		{
+			int const index = state.index;
+			phase += index;
+			down_nearest += index;
+			up_nearest += index;
+
+			// handle discontinuity at 0
+			if (phase < w)
+			{
+				// sync during downward slope creates a \/ transition
+				float const sync_fraction = config.sync_phase - float(FloorInt(config.sync_phase));
+				if (sync_fraction > 0.25f && sync_fraction < 0.75)
+					value += IntegratedPolyBLEP(phase, w);
+
+				// wave value discontinuity creates a | transition 
+				float const sync_value = GetTriangleValue(sync_fraction);
+				value -= PolyBLEP(phase, w, sync_value);
+			}
+
+			// handle /\ and \/ slope discontinuities
+			if (down_nearest > 0 && down_nearest < config.sync_phase)
+				value -= IntegratedPolyBLEP(phase - down_nearest, w);
+			if (up_nearest > 0 && up_nearest < config.sync_phase)
+				value += IntegratedPolyBLEP(phase - up_nearest, w);
+
+			// handle discontinuity at sync phase
+			if (phase - config.sync_phase > -w)
+			{
+				// sync during downward slope creates a \/ transition
+				float const sync_fraction = config.sync_phase - float(FloorInt(config.sync_phase));
+				if (sync_fraction > 0.25f && sync_fraction < 0.75)
+					value += IntegratedPolyBLEP(phase - config.sync_phase, w);
+
+				// wave value discontinuity creates a | transition 
+				float const sync_value = GetTriangleValue(sync_fraction);
+				value -= PolyBLEP(phase - config.sync_phase, w, sync_value);
+			}
+		}
+		else
+		{
+			// handle /\ and \/ slope discontinuities
+			value -= IntegratedPolyBLEP(phase - down_nearest, w);
+			value += IntegratedPolyBLEP(phase - up_nearest, w);
+		}
+	}
+#endif
+	return value;
+}
+
+// triangle wave
+// (flags tested at run time; see triangle_render for block rendering)
+float OscillatorTriangle(OscillatorConfig const &config, OscillatorState &state, float step)
+{
+	if (!use_antialias)
+		return EvaluateTriangle<false, false>(config, state, step);
+	if (config.sync_enable)
+		return EvaluateTriangle<true, true>(config, state, step);
+	return EvaluateTriangle<true, false>(config, state, step);
+}
+
+// triangle wave for a group of oscillators
+// (same as OscillatorTriangle without hard sync)
+template<bool ANTIALIASED> static void OscillatorTriangleGroup(OscillatorConfig const &config, OscillatorGroup &group, size_t count)
+{
+	SIMDFloat amplitude(config.amplitude);
+	SIMDFloat const amplitude_step(config.amplitude_step);
+	for (size_t i = 0; i < count; ++i)
+	{
+		SIMDFloat const silent = group.delta > SIMDFloat(0.5f);
+		SIMDFloat const w = Min(group.delta * SIMDFloat(INTEGRATED_POLYBLEP_WIDTH), SIMDFloat(0.5f));
+		SIMDFloat const phase = group.phase;
+		SIMDFloat value = GetTriangleValue(phase);
+#if ANTIALIAS == ANTIALIAS_POLYBLEP
+		if (ANTIALIASED)
+		{
+			// nearest /\ slope transition
+			SIMDFloat const down_nearest = Select(phase >= SIMDFloat(0.75f), SIMDFloat(1.0f), SIMDFloat(0.0f)) + SIMDFloat(0.25f);
+
+			// nearest \/ slope transition
+			SIMDFloat const up_nearest = Select(phase >= SIMDFloat(0.25f), SIMDFloat(1.0f), SIMDFloat(0.0f)) - SIMDFloat(0.25f);
+
+			// handle /\ and \/ slope discontinuities
+			value = value - IntegratedPolyBLEP(phase - down_nearest, w);
+			value = value + IntegratedPolyBLEP(phase - up_nearest, w);
+		}
+#endif
+		group.Accumulate(i, amplitude * Select(silent, SIMDFloat(0.0f), value));
+		amplitude = amplitude + amplitude_step;
+		group.Advance();
+	}
+}
+
+// triangle wave kernels
+WaveRender const triangle_render[2][2][2] = OSCILLATOR_KERNELS(EvaluateTriangle);
+
+// triangle wave group functions
+WaveRenderGroup const triangle_render_group[2] = { OscillatorTriangleGroup<false>, OscillatorTriangleGroup<true> };
+
+// band-limited triangle wave
+class TriangleTableReader
+{
+public:
+	WavetableMip mip;
+
+	TriangleTableReader(OscillatorConfig const &, float const delta)
+		: mip(delta)
+	{
+	}
+
+	float Read(float const phase) const
+	{
+		return mip.Read(triangle_wavetable, phase);
+	}
+};
+
+// triangle wavetable kernels
+WaveRender const triangle_table_render[2] = WAVETABLE_KERNELS(TriangleTableReader);
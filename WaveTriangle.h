@@ -1,12 +1,25 @@
-#pragma once
-/*
-MINI VIRTUAL ANALOG SYNTHESIZER
-Copyright 2014 Kenneth D. Miller III
-
-Triangle Wave
-*/
-
-class OscillatorConfig;
-class OscillatorState;
-
-extern float OscillatorTriangle(OscillatorConfig const &config, OscillatorState &state, float step);
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Triangle Wave
+*/
+
+class OscillatorConfig;
+class OscillatorState;
+class OscillatorGroup;
+
+extern float OscillatorTriangle(OscillatorConfig const &config, OscillatorState &state, float step);
+
+// triangle wave kernels
+// (indexed by antialiasing, hard sync, and sub-oscillator)
+extern WaveRender const triangle_render[2][2][2];
+
+// triangle wave group functions
+// (indexed by antialiasing)
+extern WaveRenderGroup const triangle_render_group[2];
+
+// triangle wavetable kernels
+// (indexed by sub-oscillator)
+extern WaveRender const triangle_table_render[2];
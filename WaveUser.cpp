@@ -0,0 +1,80 @@
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+User Wavetable Wave
+*/
+#include "Platform.h"
+
+#include "Wave.h"
+#include "WaveUser.h"
+#include "Oscillator.h"
+#include "OscillatorKernel.h"
+#include "Wavetable.h"
+#include "Math.h"
+
+// levels for an oscillator without a wavetable
+static WavetableLevel const silent_frame[WAVETABLE_LEVELS] = {};
+
+// user wavetable wave
+// - wave parameter 0 to 1 scans from the first frame to the last
+// - adjacent frames cross-fade
+// - levels are band-limited, so the wave needs no other antialiasing
+class UserWavetableReader
+{
+public:
+	WavetableMip mip;
+	WavetableLevel const *frame0;
+	WavetableLevel const *frame1;
+	float fade;
+
+	UserWavetableReader(OscillatorConfig const &config, float const delta)
+		: mip(delta)
+	{
+		WavetableFile const *table = config.wavetable;
+		if (!table)
+		{
+			frame0 = frame1 = silent_frame;
+			fade = 0.0f;
+			return;
+		}
+		float const position = Clamp(config.waveparam, 0.0f, 1.0f) * (table->frames - 1);
+		int const frame = Min(FloorInt(position), Max(table->frames - 2, 0));
+		frame0 = table->Frame(frame);
+		frame1 = table->Frame(Min(frame + 1, table->frames - 1));
+		fade = position - frame;
+	}
+
+	float Read(float const phase) const
+	{
+		return Lerp(mip.Read(frame0, phase), mip.Read(frame1, phase), fade);
+	}
+};
+template<bool ANTIALIASED, bool SYNC> static __forceinline float EvaluateUserWavetable(OscillatorConfig const &config, OscillatorState &state, float step)
+{
+	if (step > 0.5f)
+		return 0.0f;
+	return UserWavetableReader(config, step).Read(state.phase);
+}
+
+// user wavetable wave
+// (chooses levels and frames every call; see user_wavetable_render for block rendering)
+float OscillatorUserWavetable(OscillatorConfig const &config, OscillatorState &state, float step)
+{
+	return EvaluateUserWavetable<false, false>(config, state, step);
+}
+
+// user wavetable wave kernels
+// (the wavetable kernel without hard sync, with or without antialiasing;
+// the wave evaluator with hard sync, which leaves the sync edge aliased)
+WaveRender const user_wavetable_render[2][2][2] =
+{
+	{
+		WAVETABLE_KERNELS(UserWavetableReader),
+		{ OscillatorKernel<EvaluateUserWavetable<false, true>, true, false>, OscillatorKernel<EvaluateUserWavetable<false, true>, true, true> },
+	},
+	{
+		WAVETABLE_KERNELS(UserWavetableReader),
+		{ OscillatorKernel<EvaluateUserWavetable<true, true>, true, false>, OscillatorKernel<EvaluateUserWavetable<true, true>, true, true> },
+	},
+};
@@ -0,0 +1,18 @@
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+User Wavetable Wave
+*/
+
+class OscillatorConfig;
+class OscillatorState;
+
+// user wavetable wave
+// (scans the frames of the oscillator's loaded wavetable with the wave parameter)
+extern float OscillatorUserWavetable(OscillatorConfig const &config, OscillatorState &state, float step);
+
+// user wavetable wave kernels
+// (indexed by antialiasing, hard sync, and sub-oscillator)
+extern WaveRender const user_wavetable_render[2][2][2];
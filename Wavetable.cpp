@@ -0,0 +1,319 @@
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Band-Limited Wavetables
+*/
+#include "Platform.h"
+
+#include "Wavetable.h"
+#include "Fourier.h"
+#include "WaveCache.h"
+
+// A wavetable file is a wave file (.wav) holding one or more frames of
+// WAVETABLE_SIZE samples each, in 16-, 24-, or 32-bit integer or 32-bit
+// float format; only the first channel is used.  Loading band-limits
+// each frame into WAVETABLE_LEVELS levels without DC and saves them in
+// a cache file named after the wave file with ".mip" appended.  Later
+// loads map the cache file instead of building the levels again, so
+// processes using the same wavetable share one copy in memory.
+
+// shared wavetables
+Wavetable sawtooth_wavetable;
+Wavetable triangle_wavetable;
+
+// most wavetable files loaded at once
+#define WAVETABLE_FILES_MAX 256
+
+// loaded wavetable files
+static WavetableFile wavetable_file[WAVETABLE_FILES_MAX];
+static int wavetable_file_count;
+
+// wavetable cache file header
+// (followed by the levels of every frame)
+struct WavetableCacheHeader
+{
+	char magic[8];
+	unsigned int size;
+	unsigned int levels;
+	unsigned int frames;
+	unsigned int reserved;
+	unsigned long long source_bytes;
+	unsigned long long source_hash;
+};
+static char const wavetable_cache_magic[8] = { 'M', 'V', 'A', 'S', 'M', 'I', 'P', '1' };
+
+// one cycle of a sine wave
+static double wavetable_sine[WAVETABLE_SIZE];
+
+// build every level from the sine amplitude of each harmonic
+// (each level adds the next octave of harmonics to the level below it)
+void Wavetable::Build(double (*amplitude)(int harmonic))
+{
+	static double sum[WAVETABLE_SIZE];
+	memset(sum, 0, sizeof(sum));
+	memset(level[0], 0, sizeof(level[0]));
+
+	int harmonic = 1;
+	for (int k = 1; k < WAVETABLE_LEVELS; ++k)
+	{
+		// add harmonics through 2**(k-1)
+		for (; harmonic <= 1 << (k - 1); ++harmonic)
+		{
+			double const a = amplitude(harmonic);
+			if (a == 0.0)
+				continue;
+			for (int i = 0; i < WAVETABLE_SIZE; ++i)
+				sum[i] += a * wavetable_sine[(harmonic * i) & (WAVETABLE_SIZE - 1)];
+		}
+
+		for (int i = 0; i < WAVETABLE_SIZE; ++i)
+			level[k][i] = float(sum[i]);
+		level[k][WAVETABLE_SIZE] = level[k][0];
+	}
+}
+
+// sawtooth wave harmonics
+// - 2/pi sum k=1..infinity sin(k*2*pi*phase)/k
+static double SawtoothHarmonic(int const k)
+{
+	return 2.0 / (M_PI * k);
+}
+
+// triangle wave harmonics
+// - 8/pi**2 sum k=0..infinity (-1)**k sin((2*k+1)*2*pi*phase)/(2*k+1)**2
+static double TriangleHarmonic(int const k)
+{
+	if ((k & 1) == 0)
+		return 0.0;
+	return ((k & 2) ? -8.0 : 8.0) / (M_PI * M_PI * k * k);
+}
+
+// build the shared wavetables
+void InitWavetable()
+{
+	for (int i = 0; i < WAVETABLE_SIZE; ++i)
+		wavetable_sine[i] = sin(2.0 * M_PI * i / WAVETABLE_SIZE);
+
+	sawtooth_wavetable.Build(SawtoothHarmonic);
+	triangle_wavetable.Build(TriangleHarmonic);
+}
+
+// band-limit one frame into levels
+// (each level keeps harmonics 1 through 2**(k-1) of the frame spectrum)
+static void BuildWavetableFrame(float const sample[], WavetableLevel level[])
+{
+	static double spectrum_real[WAVETABLE_SIZE], spectrum_imag[WAVETABLE_SIZE];
+	static double real[WAVETABLE_SIZE], imag[WAVETABLE_SIZE];
+
+	for (int i = 0; i < WAVETABLE_SIZE; ++i)
+	{
+		spectrum_real[i] = sample[i];
+		spectrum_imag[i] = 0.0;
+	}
+	TransformFourier(spectrum_real, spectrum_imag, WAVETABLE_SIZE, false);
+
+	memset(level[0], 0, sizeof(level[0]));
+	for (int k = 1; k < WAVETABLE_LEVELS; ++k)
+	{
+		int const harmonics = 1 << (k - 1);
+		memset(real, 0, sizeof(real));
+		memset(imag, 0, sizeof(imag));
+		for (int h = 1; h <= harmonics; ++h)
+		{
+			real[h] = spectrum_real[h];
+			imag[h] = spectrum_imag[h];
+			real[WAVETABLE_SIZE - h] = spectrum_real[WAVETABLE_SIZE - h];
+			imag[WAVETABLE_SIZE - h] = spectrum_imag[WAVETABLE_SIZE - h];
+		}
+		TransformFourier(real, imag, WAVETABLE_SIZE, true);
+		for (int i = 0; i < WAVETABLE_SIZE; ++i)
+			level[k][i] = float(real[i] / WAVETABLE_SIZE);
+		level[k][WAVETABLE_SIZE] = level[k][0];
+	}
+}
+
+// read a little-endian unsigned integer
+static unsigned int ReadLittleEndian(unsigned char const *data, int const bytes)
+{
+	unsigned int value = 0;
+	for (int i = bytes - 1; i >= 0; --i)
+		value = (value << 8) | data[i];
+	return value;
+}
+
+// decode the samples of the first channel of a wave file
+// (returns the sample count, or 0 if the format is not supported;
+// sample is NULL to count the samples without decoding them)
+static size_t DecodeWaveFile(unsigned char const *data, size_t const bytes, float sample[])
+{
+	if (bytes < 12 || memcmp(data, "RIFF", 4) != 0 || memcmp(data + 8, "WAVE", 4) != 0)
+		return 0;
+
+	unsigned int format = 0, channels = 0, bits = 0;
+	for (size_t offset = 12; offset + 8 <= bytes; )
+	{
+		unsigned char const *chunk = data + offset;
+		size_t const chunk_bytes = Min(size_t(ReadLittleEndian(chunk + 4, 4)), bytes - offset - 8);
+		if (memcmp(chunk, "fmt ", 4) == 0 && chunk_bytes >= 16)
+		{
+			format = ReadLittleEndian(chunk + 8, 2);
+			channels = ReadLittleEndian(chunk + 10, 2);
+			bits = ReadLittleEndian(chunk + 22, 2);
+
+			// extensible format stores the format in its subformat
+			if (format == 0xFFFE && chunk_bytes >= 26)
+				format = ReadLittleEndian(chunk + 32, 2);
+		}
+		else if (memcmp(chunk, "data", 4) == 0)
+		{
+			bool const pcm = format == 1 && (bits == 16 || bits == 24 || bits == 32);
+			bool const ieee = format == 3 && bits == 32;
+			if (channels == 0 || (!pcm && !ieee))
+				return 0;
+			size_t const frame_bytes = channels * bits / 8;
+			size_t const count = chunk_bytes / frame_bytes;
+			if (!sample)
+				return count;
+			for (size_t i = 0; i < count; ++i)
+			{
+				unsigned char const *p = chunk + 8 + i * frame_bytes;
+				if (ieee)
+				{
+					union { unsigned int i; float f; } value = { ReadLittleEndian(p, 4) };
+					sample[i] = value.f;
+				}
+				else
+				{
+					// sign-extend from the top bits
+					int const value = int(ReadLittleEndian(p, bits / 8) << (32 - bits));
+					sample[i] = float(value) * (1.0f / 2147483648.0f);
+				}
+			}
+			return count;
+		}
+		offset += 8 + chunk_bytes + (chunk_bytes & 1);
+	}
+	return 0;
+}
+
+// 64-bit FNV-1a hash
+static unsigned long long HashBytes(unsigned char const *data, size_t const bytes)
+{
+	unsigned long long hash = 14695981039346656037ULL;
+	for (size_t i = 0; i < bytes; ++i)
+		hash = (hash ^ data[i]) * 1099511628211ULL;
+	return hash;
+}
+
+// check a wavetable cache file against its wave file
+// (returns the frame count, or 0 if the cache does not match)
+static int CheckWavetableCache(MappedFile const &cache, size_t const source_bytes, unsigned long long const source_hash)
+{
+	if (cache.size < sizeof(WavetableCacheHeader))
+		return 0;
+	WavetableCacheHeader const &header = *static_cast<WavetableCacheHeader const *>(cache.data);
+	if (memcmp(header.magic, wavetable_cache_magic, sizeof(header.magic)) != 0 ||
+		header.size != WAVETABLE_SIZE ||
+		header.levels != WAVETABLE_LEVELS ||
+		header.frames == 0 ||
+		header.source_bytes != source_bytes ||
+		header.source_hash != source_hash ||
+		cache.size != sizeof(WavetableCacheHeader) + size_t(header.frames) * WAVETABLE_LEVELS * sizeof(WavetableLevel))
+		return 0;
+	return int(header.frames);
+}
+
+// load a wavetable from a wave file
+WavetableFile const *LoadWavetable(char const *filename)
+{
+	// share wavetables already loaded
+	for (int i = 0; i < wavetable_file_count; ++i)
+	{
+		if (strcmp(wavetable_file[i].filename, filename) == 0)
+			return &wavetable_file[i];
+	}
+	if (wavetable_file_count >= WAVETABLE_FILES_MAX)
+	{
+		fprintf(stderr, "Too many wavetables loading \"%s\"\n", filename);
+		return NULL;
+	}
+
+	// identify the wave file contents
+	MappedFile source;
+	if (!source.Open(filename))
+	{
+		fprintf(stderr, "Can't open wavetable \"%s\"\n", filename);
+		return NULL;
+	}
+	unsigned char const *source_data = static_cast<unsigned char const *>(source.data);
+	unsigned long long const source_hash = HashBytes(source_data, source.size);
+
+	WavetableFile &table = wavetable_file[wavetable_file_count];
+	table.memory = NULL;
+
+	// use the cache file if it matches
+	size_t const name_length = strlen(filename);
+	char *cache_name = static_cast<char *>(malloc(name_length + 5));
+	memcpy(cache_name, filename, name_length);
+	memcpy(cache_name + name_length, ".mip", 5);
+	if (table.cache.Open(cache_name))
+	{
+		table.frames = CheckWavetableCache(table.cache, source.size, source_hash);
+		if (table.frames == 0)
+			table.cache.Close();
+	}
+
+	if (!table.cache.data)
+	{
+		// decode the wave file
+		size_t const count = DecodeWaveFile(source_data, source.size, NULL);
+		int const frames = int(count / WAVETABLE_SIZE);
+		if (frames == 0)
+		{
+			fprintf(stderr, "Wavetable \"%s\" needs at least %d samples of 16-, 24-, or 32-bit audio\n", filename, WAVETABLE_SIZE);
+			free(cache_name);
+			return NULL;
+		}
+		float *sample = static_cast<float *>(malloc(count * sizeof(float)));
+		DecodeWaveFile(source_data, source.size, sample);
+
+		// band-limit each frame after the cache header
+		size_t const bytes = sizeof(WavetableCacheHeader) + size_t(frames) * WAVETABLE_LEVELS * sizeof(WavetableLevel);
+		table.memory = malloc(bytes);
+		WavetableCacheHeader &header = *static_cast<WavetableCacheHeader *>(table.memory);
+		memcpy(header.magic, wavetable_cache_magic, sizeof(header.magic));
+		header.size = WAVETABLE_SIZE;
+		header.levels = WAVETABLE_LEVELS;
+		header.frames = frames;
+		header.reserved = 0;
+		header.source_bytes = source.size;
+		header.source_hash = source_hash;
+		WavetableLevel *level = reinterpret_cast<WavetableLevel *>(&header + 1);
+		for (int frame = 0; frame < frames; ++frame)
+			BuildWavetableFrame(sample + frame * WAVETABLE_SIZE, level + frame * WAVETABLE_LEVELS);
+		free(sample);
+		table.frames = frames;
+
+		// save the cache file and map it in place of the heap copy
+		// (SaveWaveCache renames it into place, so processes that already
+		// map an older cache file keep their copy; another process may have
+		// saved its own file first, so check what got mapped)
+		if (SaveWaveCache(table.cache, cache_name, table.memory, bytes) &&
+			CheckWavetableCache(table.cache, source.size, source_hash) != frames)
+			table.cache.Close();
+		if (table.cache.data)
+		{
+			free(table.memory);
+			table.memory = NULL;
+		}
+	}
+	free(cache_name);
+
+	void const *data = table.cache.data ? table.cache.data : table.memory;
+	table.level = reinterpret_cast<WavetableLevel const *>(static_cast<WavetableCacheHeader const *>(data) + 1);
+	table.filename = static_cast<char *>(malloc(name_length + 1));
+	memcpy(table.filename, filename, name_length + 1);
+	++wavetable_file_count;
+	return &table;
+}
@@ -0,0 +1,178 @@
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Band-Limited Wavetables
+*/
+
+#include "OscillatorKernel.h"
+#include "MappedFile.h"
+#include "Math.h"
+
+// samples per wavetable cycle
+// (a power of two)
+#define WAVETABLE_SIZE 2048
+
+// band-limited levels per wavetable
+// - level k holds harmonics 1 through 2**(k-1)
+// - level 0 is silent
+// - the top level holds WAVETABLE_SIZE / 4 harmonics
+#define WAVETABLE_LEVELS 11
+
+// one band-limited cycle
+// (with one extra sample for interpolation)
+typedef float WavetableLevel[WAVETABLE_SIZE + 1];
+
+// wavetable with one band-limited cycle per octave
+class Wavetable
+{
+public:
+	WavetableLevel level[WAVETABLE_LEVELS];
+
+	// build every level from the sine amplitude of each harmonic
+	void Build(double (*amplitude)(int harmonic));
+};
+
+// pair of adjacent wavetable levels for a phase step
+// - the upper level has no harmonics above the Nyquist frequency
+// - the fade brings in its top octave as the pitch falls, so levels
+//   change without a step in brightness
+class WavetableMip
+{
+public:
+	int lo;
+	int hi;
+	float fade;
+
+	explicit WavetableMip(float const delta)
+	{
+		// octaves below the Nyquist frequency
+		float const octaves = FastLog2(0.5f / Max(delta, FLT_MIN));
+		if (octaves < 0.0f)
+		{
+			lo = hi = 0;
+			fade = 0.0f;
+		}
+		else if (octaves >= WAVETABLE_LEVELS - 1)
+		{
+			lo = hi = WAVETABLE_LEVELS - 1;
+			fade = 0.0f;
+		}
+		else
+		{
+			lo = FloorInt(octaves);
+			hi = lo + 1;
+			fade = octaves - lo;
+		}
+	}
+
+	// interpolated wavetable value
+	// (level points to the WAVETABLE_LEVELS levels of one wavetable;
+	// phase in [0, 2); the table index wraps around)
+	float Read(WavetableLevel const level[], float const phase) const
+	{
+		float const x = phase * WAVETABLE_SIZE;
+		int const whole = TruncateInt(x);
+		float const s = x - whole;
+		int const i = whole & (WAVETABLE_SIZE - 1);
+		float const lo_value = Lerp(level[lo][i], level[lo][i + 1], s);
+		float const hi_value = Lerp(level[hi][i], level[hi][i + 1], s);
+		return Lerp(lo_value, hi_value, fade);
+	}
+	float Read(Wavetable const &table, float const phase) const
+	{
+		return Read(table.level, phase);
+	}
+};
+
+// shared wavetables
+extern Wavetable sawtooth_wavetable;
+extern Wavetable triangle_wavetable;
+
+// build the shared wavetables
+extern void InitWavetable();
+
+// wavetable loaded from a wave file
+// (frames of band-limited levels in read-only memory, shared by every
+// oscillator that loads the same file; see LoadWavetable)
+class WavetableFile
+{
+public:
+	char *filename;
+	int frames;
+
+	// levels of each frame
+	WavetableLevel const *level;
+
+	// levels of a frame
+	WavetableLevel const *Frame(int const frame) const
+	{
+		return level + frame * WAVETABLE_LEVELS;
+	}
+
+	// memory-mapped cache file holding the levels
+	// (or heap memory if the cache could not be written)
+	MappedFile cache;
+	void *memory;
+};
+
+// load a wavetable from a wave file
+// (returns the already loaded wavetable for the same file name,
+// or NULL if the file could not be loaded)
+extern WavetableFile const *LoadWavetable(char const *filename);
+
+// render one note oscillator from wavetables for a block of steps
+// (the same as OscillatorKernel without hard sync; READER chooses the
+// levels once for the block and returns the wave value at a phase)
+template<class READER, bool SUB> void WavetableKernel(NoteOscillatorConfig const &config, OscillatorState &state, float step, float buffer[], size_t count)
+{
+	float delta = config.frequency * config.adjust * step;
+	float const delta_step = config.frequency_step * config.adjust * step;
+
+	// levels for the highest pitch the block ramps to
+	float const top = Max(delta, delta + delta_step * float(count));
+	NoteOscillatorConfig ramp(config);
+	READER reader(config, top);
+
+	// silent above the Nyquist frequency like the wave functions
+	float amplitude = top > 0.5f ? 0.0f : config.amplitude;
+	float const amplitude_step = top > 0.5f ? 0.0f : config.amplitude_step;
+#if OSCILLATOR_PHASE != OSCILLATOR_PHASE_FLOAT
+	unsigned long long delta_fixed = PhaseToFixed(delta);
+#endif
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		// accumulate sub-oscillator value
+		if (SUB)
+			buffer[i] += config.sub_osc_amplitude * SubOscillator(config, state, step);
+
+		// accumulate oscillator value
+		buffer[i] += amplitude * reader.Read(state.phase);
+		amplitude += amplitude_step;
+
+		// advance oscillator phase
+#if OSCILLATOR_PHASE == OSCILLATOR_PHASE_FLOAT
+		state.Advance<false>(config, delta);
+#else
+		state.AdvanceFixed<false>(config, delta_fixed, 0);
+#endif
+
+		// ramp phase step and wave parameter
+		delta += delta_step;
+#if OSCILLATOR_PHASE != OSCILLATOR_PHASE_FLOAT
+		if (delta_step != 0.0f)
+			delta_fixed = PhaseToFixed(delta);
+#endif
+		if (config.waveparam_step != 0.0f)
+		{
+			ramp.waveparam += config.waveparam_step;
+			reader = READER(ramp, top);
+		}
+	}
+}
+
+// wavetable kernels for a wavetable reader class
+// (the result initializes a wavetable render table indexed by sub-oscillator)
+#define WAVETABLE_KERNELS(reader) { WavetableKernel<reader, false>, WavetableKernel<reader, true> }
@@ -0,0 +1,151 @@
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Worker Pool
+*/
+#include "Platform.h"
+
+#include "WorkerPool.h"
+
+#include <atomic>
+#include <thread>
+#include <chrono>
+
+// maximum number of worker threads
+static int const WORKER_MAX = 64;
+
+// number of worker threads
+int worker_count = 0;
+
+static std::thread worker_thread[WORKER_MAX];
+
+// current batch
+// (written before the batch is published in work_state)
+static WorkerJob work_job;
+static void *work_context;
+
+// packed batch state so a worker can never take a job from a stale batch:
+// generation in the top 32 bits, job count in the next 16, next job index in the bottom 16
+static std::atomic<unsigned long long> work_state(0);
+
+// number of jobs finished in the current batch
+static std::atomic<int> work_done(0);
+
+// set when the workers should exit
+static std::atomic<bool> work_quit(false);
+
+static inline unsigned int StateGeneration(unsigned long long state)
+{
+	return (unsigned int)(state >> 32);
+}
+static inline int StateCount(unsigned long long state)
+{
+	return int((state >> 16) & 0xFFFF);
+}
+static inline int StateIndex(unsigned long long state)
+{
+	return int(state & 0xFFFF);
+}
+
+// take and run jobs from the given batch until none are left
+static void WorkerTakeJobs(unsigned int generation)
+{
+	unsigned long long state = work_state.load(std::memory_order_acquire);
+	while (StateGeneration(state) == generation && StateIndex(state) < StateCount(state))
+	{
+		if (work_state.compare_exchange_weak(state, state + 1, std::memory_order_acq_rel))
+		{
+			work_job(StateIndex(state), work_context);
+			work_done.fetch_add(1, std::memory_order_release);
+			state = work_state.load(std::memory_order_acquire);
+		}
+	}
+}
+
+// pause briefly while spinning
+static inline void WorkerPause()
+{
+#if defined(_M_X64) || _M_IX86_FP > 0 || defined(__SSE__)
+	_mm_pause();
+#endif
+}
+
+// worker thread
+static void WorkerThread()
+{
+	// match the denormal handling of the audio thread
+	FlushDenormals();
+
+	unsigned int seen = StateGeneration(work_state.load(std::memory_order_acquire));
+	int idle = 0;
+	while (!work_quit.load(std::memory_order_acquire))
+	{
+		unsigned int const generation = StateGeneration(work_state.load(std::memory_order_acquire));
+		if (generation == seen)
+		{
+			// spin, then yield, then sleep while there is no work
+			if (idle < 1000)
+				WorkerPause();
+			else if (idle < 100000)
+				std::this_thread::yield();
+			else
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			++idle;
+			continue;
+		}
+		seen = generation;
+		idle = 0;
+		WorkerTakeJobs(generation);
+	}
+}
+
+// start worker threads
+void WorkerInit(int count)
+{
+	WorkerDone();
+
+	if (count < 0)
+		count = int(std::thread::hardware_concurrency()) - 1;
+	if (count > WORKER_MAX)
+		count = WORKER_MAX;
+
+	work_quit.store(false, std::memory_order_release);
+	for (worker_count = 0; worker_count < count; ++worker_count)
+		worker_thread[worker_count] = std::thread(WorkerThread);
+}
+
+// stop worker threads
+void WorkerDone()
+{
+	work_quit.store(true, std::memory_order_release);
+	for (int i = 0; i < worker_count; ++i)
+		worker_thread[i].join();
+	worker_count = 0;
+}
+
+// run a batch of jobs and wait for all of them to finish
+void WorkerRun(WorkerJob job, void *context, int count)
+{
+	assert(count <= 0xFFFF);
+
+	// run small batches directly
+	if (worker_count == 0 || count <= 1)
+	{
+		for (int i = 0; i < count; ++i)
+			job(i, context);
+		return;
+	}
+
+	// publish the batch
+	work_job = job;
+	work_context = context;
+	work_done.store(0, std::memory_order_relaxed);
+	unsigned int const generation = StateGeneration(work_state.load(std::memory_order_relaxed)) + 1;
+	work_state.store((unsigned long long)generation << 32 | (unsigned long long)count << 16, std::memory_order_release);
+
+	// help out, then wait for stragglers
+	WorkerTakeJobs(generation);
+	while (work_done.load(std::memory_order_acquire) < count)
+		WorkerPause();
+}
@@ -0,0 +1,26 @@
+#pragma once
+/*
+MINI VIRTUAL ANALOG SYNTHESIZER
+Copyright 2014 Kenneth D. Miller III
+
+Worker Pool
+(pre-spawned threads for splitting audio rendering across cores)
+*/
+
+// job function: runs one job of a batch
+typedef void(*WorkerJob)(int job, void *context);
+
+// number of worker threads
+// (not counting the thread that calls WorkerRun)
+extern int worker_count;
+
+// start worker threads
+// (a negative count uses one fewer than the number of hardware threads)
+extern void WorkerInit(int count = -1);
+
+// stop worker threads
+extern void WorkerDone();
+
+// run a batch of jobs and wait for all of them to finish
+// (the calling thread takes jobs too; does not allocate or lock)
+extern void WorkerRun(WorkerJob job, void *context, int count);